@@ -1,10 +1,43 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20190308
+dnl Version: 20261019
 
 dnl Function to detect if libcsplit dependencies are available
 AC_DEFUN([AX_LIBCSPLIT_CHECK_LOCAL],
-  [dnl No additional checks.
+  [dnl Headers and functions used in libcsplit/libcsplit_mapped_file.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+    AC_CHECK_FUNCS([close fstat madvise mmap munmap open])
+
+    dnl Headers and libraries used in libcsplit/libcsplit_narrow_record_reader.c
+    AC_CHECK_HEADERS([pthread.h])
+
+    dnl The pthread library is only added to the libcsplit library
+    dnl and the private libraries of the pkg-config file, not to LIBS
+    AS_IF(
+      [test "x$ac_cv_header_pthread_h" = xyes],
+      [ac_libcsplit_pthread_backup_LIBS="$LIBS"
+
+      AC_SEARCH_LIBS(
+        [pthread_create],
+        [pthread])
+
+      LIBS="$ac_libcsplit_pthread_backup_LIBS"
+
+      AS_IF(
+        [test "x$ac_cv_search_pthread_create" != xno && test "x$ac_cv_search_pthread_create" != "xnone required"],
+        [AC_SUBST(
+          [PTHREAD_LIBADD],
+          [$ac_cv_search_pthread_create])
+
+        AC_SUBST(
+          [ax_pthread_pc_libs_private],
+          [$ac_cv_search_pthread_create])
+        ])
+      ])
+  ])
   ])
 
 dnl Function to check if DLL support is needed
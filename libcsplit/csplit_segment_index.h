@@ -0,0 +1,103 @@
+/*
+ * The segment index file format definitions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CSPLIT_SEGMENT_INDEX_H )
+#define _CSPLIT_SEGMENT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct csplit_segment_index_file_header csplit_segment_index_file_header_t;
+
+struct csplit_segment_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "CSPLTIDX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The checkpoint interval
+	 * Consists of 4 bytes
+	 */
+	uint8_t checkpoint_interval[ 4 ];
+
+	/* The size of the indexed data
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The number of segments
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_segments[ 8 ];
+
+	/* The size of the segment offset stream
+	 * Consists of 8 bytes
+	 */
+	uint8_t stream_size[ 8 ];
+
+	/* The number of checkpoints
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_checkpoints[ 8 ];
+
+	/* The delimiter
+	 * Consists of 1 byte
+	 */
+	uint8_t delimiter;
+
+	/* Padding
+	 * Consists of 7 bytes
+	 */
+	uint8_t padding[ 7 ];
+};
+
+typedef struct csplit_segment_index_checkpoint csplit_segment_index_checkpoint_t;
+
+struct csplit_segment_index_checkpoint
+{
+	/* The offset of the segment in the indexed data
+	 * Consists of 8 bytes
+	 */
+	uint8_t segment_offset[ 8 ];
+
+	/* The offset in the segment offset stream of the next segment
+	 * Consists of 8 bytes
+	 */
+	uint8_t stream_offset[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CSPLIT_SEGMENT_INDEX_H ) */
+
@@ -0,0 +1,83 @@
+/*
+ * The serialized split string definition
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CSPLIT_SPLIT_STRING_H )
+#define _CSPLIT_SPLIT_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct csplit_split_string_header csplit_split_string_header_t;
+
+struct csplit_split_string_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "CSPLTSTR"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The character size
+	 * Consists of 1 byte
+	 */
+	uint8_t character_size;
+
+	/* The size of an offset or size value in the segment table
+	 * Consists of 1 byte
+	 */
+	uint8_t offset_size;
+
+	/* The split string flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Padding
+	 * Consists of 1 byte
+	 */
+	uint8_t padding;
+
+	/* The number of segments
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_segments[ 8 ];
+
+	/* The number of characters in the string data, which is the string size
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_characters[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CSPLIT_SPLIT_STRING_H ) */
+
@@ -0,0 +1,1037 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_arrow.h"
+#include "libcsplit_definitions.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_narrow_split_string.h"
+#include "libcsplit_types.h"
+
+/* The Arrow format of an UTF-8 string view array
+ */
+static const char *libcsplit_arrow_format_utf8_view = "vu";
+
+/* The Arrow format of a list array
+ */
+static const char *libcsplit_arrow_format_list      = "+l";
+
+/* The Arrow name of the items of a list array
+ */
+static const char *libcsplit_arrow_name_list_item   = "item";
+
+/* Releases an Arrow array exported by libcsplit
+ * This function is used as the release callback of the array
+ */
+void libcsplit_arrow_array_release(
+      struct ArrowArray *array )
+{
+	libcsplit_arrow_array_data_t *array_data = NULL;
+
+	if( array == NULL )
+	{
+		return;
+	}
+	if( array->release == NULL )
+	{
+		return;
+	}
+	array_data = (libcsplit_arrow_array_data_t *) array->private_data;
+
+	if( array_data != NULL )
+	{
+		libcsplit_arrow_array_data_free(
+		 &array_data,
+		 NULL );
+	}
+	array->private_data = NULL;
+	array->release      = NULL;
+}
+
+/* Releases an Arrow schema exported by libcsplit
+ * This function is used as the release callback of the schema
+ */
+void libcsplit_arrow_schema_release(
+      struct ArrowSchema *schema )
+{
+	libcsplit_arrow_schema_data_t *schema_data = NULL;
+
+	if( schema == NULL )
+	{
+		return;
+	}
+	if( schema->release == NULL )
+	{
+		return;
+	}
+	schema_data = (libcsplit_arrow_schema_data_t *) schema->private_data;
+
+	if( schema_data != NULL )
+	{
+		if( schema_data->child_schema != NULL )
+		{
+			if( schema_data->child_schema->release != NULL )
+			{
+				schema_data->child_schema->release(
+				 schema_data->child_schema );
+			}
+			memory_free(
+			 schema_data->child_schema );
+		}
+		memory_free(
+		 schema_data );
+	}
+	schema->private_data = NULL;
+	schema->release      = NULL;
+}
+
+/* Frees array data
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_array_data_free(
+     libcsplit_arrow_array_data_t **array_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_arrow_array_data_free";
+
+	if( array_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *array_data != NULL )
+	{
+		if( ( *array_data )->child_array != NULL )
+		{
+			/* The consumer can move the child array out of its parent
+			 * in which case the release callback is cleared
+			 */
+			if( ( *array_data )->child_array->release != NULL )
+			{
+				( *array_data )->child_array->release(
+				 ( *array_data )->child_array );
+			}
+			memory_free(
+			 ( *array_data )->child_array );
+		}
+		if( ( *array_data )->variadic_buffer_sizes != NULL )
+		{
+			memory_free(
+			 ( *array_data )->variadic_buffer_sizes );
+		}
+		if( ( *array_data )->offsets != NULL )
+		{
+			memory_free(
+			 ( *array_data )->offsets );
+		}
+		if( ( *array_data )->views != NULL )
+		{
+			memory_free(
+			 ( *array_data )->views );
+		}
+		if( ( *array_data )->buffers != NULL )
+		{
+			memory_free(
+			 ( *array_data )->buffers );
+		}
+		memory_free(
+		 *array_data );
+
+		*array_data = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the Arrow binary views of the segments of a split string
+ * The views reference the string of the split string, which is stored
+ * in the variadic data buffer with the corresponding buffer index
+ * Segments of 12 bytes or less are stored inline in the view
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_set_views(
+     libcsplit_internal_narrow_split_string_t *internal_split_string,
+     int32_t buffer_index,
+     uint8_t *views,
+     size_t views_size,
+     libcerror_error_t **error )
+{
+	uint8_t *view          = NULL;
+	char *string_segment   = NULL;
+	static char *function  = "libcsplit_arrow_set_views";
+	size_t segment_offset  = 0;
+	size_t segment_length  = 0;
+	int32_t value_32bit    = 0;
+	int segment_index      = 0;
+
+	if( internal_split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid buffer index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( views == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid views.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( views_size > (size_t) SSIZE_MAX )
+	 || ( ( views_size / LIBCSPLIT_ARROW_VIEW_SIZE ) < (size_t) internal_split_string->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid views size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_split_string->string_size > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid split string - string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
+	{
+		view           = &( views[ segment_index * LIBCSPLIT_ARROW_VIEW_SIZE ] );
+		string_segment = internal_split_string->segments[ segment_index ];
+		segment_length = internal_split_string->segment_sizes[ segment_index ];
+
+		/* The segment size includes the end-of-string character
+		 * except for unterminated segments
+		 */
+		if( ( string_segment == NULL )
+		 || ( segment_length == 0 ) )
+		{
+			segment_length = 0;
+		}
+		else if( ( internal_split_string->flags & LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED ) == 0 )
+		{
+			segment_length -= 1;
+		}
+		if( memory_set(
+		     view,
+		     0,
+		     LIBCSPLIT_ARROW_VIEW_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear view: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		value_32bit = (int32_t) segment_length;
+
+		if( memory_copy(
+		     view,
+		     &value_32bit,
+		     sizeof( int32_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy length to view: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( segment_length == 0 )
+		{
+			continue;
+		}
+		if( segment_length <= LIBCSPLIT_ARROW_VIEW_MAXIMUM_INLINE_SIZE )
+		{
+			if( memory_copy(
+			     &( view[ 4 ] ),
+			     string_segment,
+			     segment_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy segment data to view: %d.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( string_segment < internal_split_string->string )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment: %d value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		segment_offset = (size_t) ( string_segment - internal_split_string->string );
+
+		if( ( segment_offset >= internal_split_string->string_size )
+		 || ( segment_length > ( internal_split_string->string_size - segment_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment: %d value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		/* The prefix contains the first 4 bytes of the segment data
+		 */
+		if( memory_copy(
+		     &( view[ 4 ] ),
+		     string_segment,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to view: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( view[ 8 ] ),
+		     &buffer_index,
+		     sizeof( int32_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer index to view: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		value_32bit = (int32_t) segment_offset;
+
+		if( memory_copy(
+		     &( view[ 12 ] ),
+		     &value_32bit,
+		     sizeof( int32_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy offset to view: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Initializes an Arrow UTF-8 string view array of the segments of split strings
+ * The string of every split string is referenced as a variadic data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_initialize_view_array(
+     struct ArrowArray *array,
+     libcsplit_narrow_split_string_t **split_strings,
+     int number_of_split_strings,
+     libcerror_error_t **error )
+{
+	libcsplit_arrow_array_data_t *array_data                        = NULL;
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	static char *function                                           = "libcsplit_arrow_initialize_view_array";
+	size_t views_offset                                             = 0;
+	size_t views_size                                               = 0;
+	int64_t number_of_segments                                      = 0;
+	int32_t number_of_data_buffers                                  = 0;
+	int32_t buffer_index                                            = 0;
+	int split_string_index                                          = 0;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_split_strings < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of split strings value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( split_string_index = 0;
+	     split_string_index < number_of_split_strings;
+	     split_string_index++ )
+	{
+		internal_split_string = (libcsplit_internal_narrow_split_string_t *) split_strings[ split_string_index ];
+
+		if( internal_split_string == NULL )
+		{
+			continue;
+		}
+		number_of_segments += internal_split_string->number_of_segments;
+
+		if( internal_split_string->string != NULL )
+		{
+			number_of_data_buffers++;
+		}
+	}
+	if( number_of_segments > (int64_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of segments value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	views_size = (size_t) number_of_segments * LIBCSPLIT_ARROW_VIEW_SIZE;
+
+	array_data = memory_allocate_structure(
+	              libcsplit_arrow_array_data_t );
+
+	if( array_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create array data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     array_data,
+	     0,
+	     sizeof( libcsplit_arrow_array_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array data.",
+		 function );
+
+		memory_free(
+		 array_data );
+
+		return( -1 );
+	}
+	/* A string view array has a validity buffer, a views buffer,
+	 * the variadic data buffers and a variadic buffer sizes buffer
+	 */
+	array_data->buffers = (const void **) memory_allocate(
+	                                       sizeof( const void * ) * ( 3 + number_of_data_buffers ) );
+
+	if( array_data->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     array_data->buffers,
+	     0,
+	     sizeof( const void * ) * ( 3 + number_of_data_buffers ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( views_size > 0 )
+	{
+		array_data->views = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * views_size );
+
+		if( array_data->views == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create views.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_data_buffers > 0 )
+	{
+		array_data->variadic_buffer_sizes = (int64_t *) memory_allocate(
+		                                                 sizeof( int64_t ) * number_of_data_buffers );
+
+		if( array_data->variadic_buffer_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create variadic buffer sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( split_string_index = 0;
+	     split_string_index < number_of_split_strings;
+	     split_string_index++ )
+	{
+		internal_split_string = (libcsplit_internal_narrow_split_string_t *) split_strings[ split_string_index ];
+
+		if( internal_split_string == NULL )
+		{
+			continue;
+		}
+		if( internal_split_string->number_of_segments > 0 )
+		{
+			if( libcsplit_arrow_set_views(
+			     internal_split_string,
+			     buffer_index,
+			     &( array_data->views[ views_offset ] ),
+			     views_size - views_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set views of split string: %d.",
+				 function,
+				 split_string_index );
+
+				goto on_error;
+			}
+			views_offset += (size_t) internal_split_string->number_of_segments * LIBCSPLIT_ARROW_VIEW_SIZE;
+		}
+
+		if( internal_split_string->string != NULL )
+		{
+			array_data->buffers[ 2 + buffer_index ]           = internal_split_string->string;
+			array_data->variadic_buffer_sizes[ buffer_index ] = (int64_t) internal_split_string->string_size;
+
+			buffer_index++;
+		}
+	}
+	array_data->buffers[ 0 ]                          = NULL;
+	array_data->buffers[ 1 ]                          = array_data->views;
+	array_data->buffers[ 2 + number_of_data_buffers ] = array_data->variadic_buffer_sizes;
+
+	array->length       = number_of_segments;
+	array->null_count   = 0;
+	array->offset       = 0;
+	array->n_buffers    = 3 + number_of_data_buffers;
+	array->n_children   = 0;
+	array->buffers      = array_data->buffers;
+	array->children     = NULL;
+	array->dictionary   = NULL;
+	array->release      = &libcsplit_arrow_array_release;
+	array->private_data = array_data;
+
+	return( 1 );
+
+on_error:
+	if( array_data != NULL )
+	{
+		libcsplit_arrow_array_data_free(
+		 &array_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Initializes an Arrow UTF-8 string view schema
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_initialize_view_schema(
+     struct ArrowSchema *schema,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_arrow_initialize_view_schema";
+
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	schema->format       = libcsplit_arrow_format_utf8_view;
+	schema->name         = name;
+	schema->metadata     = NULL;
+	schema->flags        = 0;
+	schema->n_children   = 0;
+	schema->children     = NULL;
+	schema->dictionary   = NULL;
+	schema->release      = &libcsplit_arrow_schema_release;
+	schema->private_data = NULL;
+
+	return( 1 );
+}
+
+/* Exports the segments of a split string as an Arrow UTF-8 string view array
+ * The array references the string of the split string without copying it,
+ * hence the split string must not be freed before the array is released
+ * The array and schema must be released by calling their release callback
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_export_narrow_split_string(
+     libcsplit_narrow_split_string_t *split_string,
+     struct ArrowArray *array,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_arrow_export_narrow_split_string";
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_arrow_initialize_view_array(
+	     array,
+	     &split_string,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_arrow_initialize_view_schema(
+	     schema,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize schema.",
+		 function );
+
+		array->release(
+		 array );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the segments of multiple split strings as an Arrow list array
+ * Every element of the list array contains the segments of the corresponding
+ * split string as UTF-8 string views, a NULL split string is an empty list
+ * The array references the strings of the split strings without copying them,
+ * hence the split strings must not be freed before the array is released
+ * The array and schema must be released by calling their release callback
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_arrow_export_narrow_split_strings(
+     libcsplit_narrow_split_string_t **split_strings,
+     int number_of_split_strings,
+     struct ArrowArray *array,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error )
+{
+	libcsplit_arrow_array_data_t *array_data                        = NULL;
+	libcsplit_arrow_schema_data_t *schema_data                      = NULL;
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	static char *function                                           = "libcsplit_arrow_export_narrow_split_strings";
+	int64_t number_of_segments                                      = 0;
+	int split_string_index                                          = 0;
+
+	if( split_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_split_strings < 0 )
+	 || ( number_of_split_strings == INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of split strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid schema.",
+		 function );
+
+		return( -1 );
+	}
+	array_data = memory_allocate_structure(
+	              libcsplit_arrow_array_data_t );
+
+	if( array_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create array data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     array_data,
+	     0,
+	     sizeof( libcsplit_arrow_array_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear array data.",
+		 function );
+
+		memory_free(
+		 array_data );
+
+		return( -1 );
+	}
+	/* A list array has a validity buffer and an offsets buffer
+	 */
+	array_data->buffers = (const void **) memory_allocate(
+	                                       sizeof( const void * ) * 2 );
+
+	if( array_data->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	array_data->offsets = (int32_t *) memory_allocate(
+	                                   sizeof( int32_t ) * ( number_of_split_strings + 1 ) );
+
+	if( array_data->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offsets.",
+		 function );
+
+		goto on_error;
+	}
+	array_data->offsets[ 0 ] = 0;
+
+	for( split_string_index = 0;
+	     split_string_index < number_of_split_strings;
+	     split_string_index++ )
+	{
+		internal_split_string = (libcsplit_internal_narrow_split_string_t *) split_strings[ split_string_index ];
+
+		if( internal_split_string != NULL )
+		{
+			number_of_segments += internal_split_string->number_of_segments;
+		}
+		if( number_of_segments > (int64_t) INT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		array_data->offsets[ split_string_index + 1 ] = (int32_t) number_of_segments;
+	}
+	array_data->child_array = (struct ArrowArray *) memory_allocate(
+	                                                 sizeof( struct ArrowArray ) );
+
+	if( array_data->child_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create child array.",
+		 function );
+
+		goto on_error;
+	}
+	array_data->child_array->release = NULL;
+
+	if( libcsplit_arrow_initialize_view_array(
+	     array_data->child_array,
+	     split_strings,
+	     number_of_split_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize child array.",
+		 function );
+
+		goto on_error;
+	}
+	schema_data = memory_allocate_structure(
+	               libcsplit_arrow_schema_data_t );
+
+	if( schema_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create schema data.",
+		 function );
+
+		goto on_error;
+	}
+	schema_data->child_schema = (struct ArrowSchema *) memory_allocate(
+	                                                    sizeof( struct ArrowSchema ) );
+
+	if( schema_data->child_schema == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create child schema.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcsplit_arrow_initialize_view_schema(
+	     schema_data->child_schema,
+	     libcsplit_arrow_name_list_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize child schema.",
+		 function );
+
+		goto on_error;
+	}
+	array_data->buffers[ 0 ] = NULL;
+	array_data->buffers[ 1 ] = array_data->offsets;
+
+	array->length       = number_of_split_strings;
+	array->null_count   = 0;
+	array->offset       = 0;
+	array->n_buffers    = 2;
+	array->n_children   = 1;
+	array->buffers      = array_data->buffers;
+	array->children     = &( array_data->child_array );
+	array->dictionary   = NULL;
+	array->release      = &libcsplit_arrow_array_release;
+	array->private_data = array_data;
+
+	schema->format       = libcsplit_arrow_format_list;
+	schema->name         = NULL;
+	schema->metadata     = NULL;
+	schema->flags        = 0;
+	schema->n_children   = 1;
+	schema->children     = &( schema_data->child_schema );
+	schema->dictionary   = NULL;
+	schema->release      = &libcsplit_arrow_schema_release;
+	schema->private_data = schema_data;
+
+	return( 1 );
+
+on_error:
+	if( schema_data != NULL )
+	{
+		if( schema_data->child_schema != NULL )
+		{
+			memory_free(
+			 schema_data->child_schema );
+		}
+		memory_free(
+		 schema_data );
+	}
+	if( array_data != NULL )
+	{
+		libcsplit_arrow_array_data_free(
+		 &array_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
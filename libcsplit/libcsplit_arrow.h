@@ -0,0 +1,127 @@
+/*
+ * Apache Arrow C data interface functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_ARROW_H )
+#define _LIBCSPLIT_ARROW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_narrow_split_string.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of an Arrow binary view
+ */
+#define LIBCSPLIT_ARROW_VIEW_SIZE		16
+
+/* The maximum size of string data that is stored inline in an Arrow binary view
+ */
+#define LIBCSPLIT_ARROW_VIEW_MAXIMUM_INLINE_SIZE	12
+
+typedef struct libcsplit_arrow_array_data libcsplit_arrow_array_data_t;
+
+struct libcsplit_arrow_array_data
+{
+	/* The buffers
+	 */
+	const void **buffers;
+
+	/* The views
+	 */
+	uint8_t *views;
+
+	/* The list offsets
+	 */
+	int32_t *offsets;
+
+	/* The variadic buffer sizes
+	 */
+	int64_t *variadic_buffer_sizes;
+
+	/* The child array
+	 */
+	struct ArrowArray *child_array;
+};
+
+typedef struct libcsplit_arrow_schema_data libcsplit_arrow_schema_data_t;
+
+struct libcsplit_arrow_schema_data
+{
+	/* The child schema
+	 */
+	struct ArrowSchema *child_schema;
+};
+
+void libcsplit_arrow_array_release(
+      struct ArrowArray *array );
+
+void libcsplit_arrow_schema_release(
+      struct ArrowSchema *schema );
+
+int libcsplit_arrow_array_data_free(
+     libcsplit_arrow_array_data_t **array_data,
+     libcerror_error_t **error );
+
+int libcsplit_arrow_set_views(
+     libcsplit_internal_narrow_split_string_t *internal_split_string,
+     int32_t buffer_index,
+     uint8_t *views,
+     size_t views_size,
+     libcerror_error_t **error );
+
+int libcsplit_arrow_initialize_view_array(
+     struct ArrowArray *array,
+     libcsplit_narrow_split_string_t **split_strings,
+     int number_of_split_strings,
+     libcerror_error_t **error );
+
+int libcsplit_arrow_initialize_view_schema(
+     struct ArrowSchema *schema,
+     const char *name,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_arrow_export_narrow_split_string(
+     libcsplit_narrow_split_string_t *split_string,
+     struct ArrowArray *array,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_arrow_export_narrow_split_strings(
+     libcsplit_narrow_split_string_t **split_strings,
+     int number_of_split_strings,
+     struct ArrowArray *array,
+     struct ArrowSchema *schema,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_ARROW_H ) */
+
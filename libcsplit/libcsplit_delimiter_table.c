@@ -0,0 +1,151 @@
+/*
+ * Delimiter table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_delimiter_table.h"
+#include "libcsplit_libcerror.h"
+
+/* Clears the delimiter table
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_delimiter_table_clear(
+     libcsplit_delimiter_table_t *delimiter_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_delimiter_table_clear";
+
+	if( delimiter_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid delimiter table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     delimiter_table,
+	     0,
+	     sizeof( libcsplit_delimiter_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear delimiter table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a delimiter code unit value to the delimiter table
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_delimiter_table_add_delimiter(
+     libcsplit_delimiter_table_t *delimiter_table,
+     uint32_t delimiter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_delimiter_table_add_delimiter";
+
+	if( delimiter_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid delimiter table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_delimiter_table_is_delimiter(
+	     delimiter_table,
+	     delimiter ) != 0 )
+	{
+		return( 1 );
+	}
+	if( delimiter < 256 )
+	{
+		delimiter_table->is_delimiter[ delimiter ] = 1;
+	}
+	else
+	{
+		if( delimiter_table->number_of_extended_delimiters >= LIBCSPLIT_DELIMITER_TABLE_MAXIMUM_NUMBER_OF_EXTENDED_DELIMITERS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of extended delimiters value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		delimiter_table->extended_delimiters[ delimiter_table->number_of_extended_delimiters ] = delimiter;
+
+		delimiter_table->number_of_extended_delimiters += 1;
+	}
+	if( delimiter_table->number_of_delimiters == 0 )
+	{
+		delimiter_table->first_delimiter = delimiter;
+	}
+	delimiter_table->number_of_delimiters += 1;
+
+	return( 1 );
+}
+
+/* Determines if a code unit value is a delimiter
+ * Returns 1 if the code unit value is a delimiter or 0 if not
+ */
+int libcsplit_delimiter_table_is_delimiter(
+     libcsplit_delimiter_table_t *delimiter_table,
+     uint32_t code_unit )
+{
+	int delimiter_index = 0;
+
+	if( delimiter_table == NULL )
+	{
+		return( 0 );
+	}
+	if( code_unit < 256 )
+	{
+		return( (int) delimiter_table->is_delimiter[ code_unit ] );
+	}
+	for( delimiter_index = 0;
+	     delimiter_index < delimiter_table->number_of_extended_delimiters;
+	     delimiter_index++ )
+	{
+		if( delimiter_table->extended_delimiters[ delimiter_index ] == code_unit )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
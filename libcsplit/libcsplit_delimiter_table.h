@@ -0,0 +1,84 @@
+/*
+ * Delimiter table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_DELIMITER_TABLE_H )
+#define _LIBCSPLIT_DELIMITER_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of delimiters with a code unit value of 256 or greater
+ */
+#define LIBCSPLIT_DELIMITER_TABLE_MAXIMUM_NUMBER_OF_EXTENDED_DELIMITERS	16
+
+typedef struct libcsplit_delimiter_table libcsplit_delimiter_table_t;
+
+/* The delimiter table classifies code units as delimiter or not
+ * independent of the code unit width
+ */
+struct libcsplit_delimiter_table
+{
+	/* Value to indicate a code unit value below 256 is a delimiter
+	 */
+	uint8_t is_delimiter[ 256 ];
+
+	/* The number of delimiters
+	 */
+	size_t number_of_delimiters;
+
+	/* The first delimiter, used to search for a single delimiter
+	 */
+	uint32_t first_delimiter;
+
+	/* The delimiters with a code unit value of 256 or greater
+	 */
+	uint32_t extended_delimiters[ LIBCSPLIT_DELIMITER_TABLE_MAXIMUM_NUMBER_OF_EXTENDED_DELIMITERS ];
+
+	/* The number of delimiters with a code unit value of 256 or greater
+	 */
+	int number_of_extended_delimiters;
+};
+
+int libcsplit_delimiter_table_clear(
+     libcsplit_delimiter_table_t *delimiter_table,
+     libcerror_error_t **error );
+
+int libcsplit_delimiter_table_add_delimiter(
+     libcsplit_delimiter_table_t *delimiter_table,
+     uint32_t delimiter,
+     libcerror_error_t **error );
+
+int libcsplit_delimiter_table_is_delimiter(
+     libcsplit_delimiter_table_t *delimiter_table,
+     uint32_t code_unit );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_DELIMITER_TABLE_H ) */
+
@@ -0,0 +1,1729 @@
+/*
+ * Field decoder functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_definitions.h"
+#include "libcsplit_field_decoder.h"
+#include "libcsplit_libcerror.h"
+
+/* The powers of 10 that are exactly representable as a double
+ */
+static const double libcsplit_field_decoder_powers_of_10[ 23 ] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+/* The number of days per month in a non-leap year
+ */
+static const uint8_t libcsplit_field_decoder_days_per_month[ 12 ] = {
+	31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+/* Retrieves the value of 8 decimal digits
+ * The digits are loaded into a 64-bit integer and validated and combined
+ * 8, 4 and 2 at a time, instead of one digit at a time
+ * Returns 1 if successful or 0 if the string contains a non-digit character
+ */
+static int libcsplit_field_decoder_get_eight_digits(
+            const char *string,
+            uint32_t *value_32bit )
+{
+	uint64_t digits = 0;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 (const uint8_t *) string,
+	 digits );
+
+	/* Every byte must be in the range 0x30 - 0x39, adding 6 moves the bytes
+	 * 0x3a - 0x3f into the range 0x40 - 0x45
+	 */
+	if( ( ( digits & 0xf0f0f0f0f0f0f0f0UL )
+	    | ( ( ( digits + 0x0606060606060606UL ) & 0xf0f0f0f0f0f0f0f0UL ) >> 4 ) ) != 0x3333333333333333UL )
+	{
+		return( 0 );
+	}
+	/* The first digit is stored in the least significant byte
+	 */
+	digits &= 0x0f0f0f0f0f0f0f0fUL;
+	digits  = ( digits * ( ( 10 << 8 ) + 1 ) ) >> 8;
+	digits &= 0x00ff00ff00ff00ffUL;
+	digits  = ( digits * ( ( 100 << 16 ) + 1 ) ) >> 16;
+	digits &= 0x0000ffff0000ffffUL;
+	digits  = ( digits * ( ( (uint64_t) 10000 << 32 ) + 1 ) ) >> 32;
+
+	*value_32bit = (uint32_t) digits;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a small fixed number of decimal digits
+ * Returns 1 if successful or 0 if the string contains a non-digit character
+ */
+static int libcsplit_field_decoder_get_digits(
+            const char *string,
+            size_t number_of_digits,
+            uint32_t *value_32bit )
+{
+	size_t string_index = 0;
+	uint32_t value      = 0;
+
+	for( string_index = 0;
+	     string_index < number_of_digits;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (uint32_t) ( string[ string_index ] - '0' );
+	}
+	*value_32bit = value;
+
+	return( 1 );
+}
+
+/* Retrieves the number of nanoseconds of a fraction of a second
+ * Digits beyond the ninth are validated but do not contribute to the value
+ * Returns 1 if successful or 0 if the string contains a non-digit character
+ */
+static int libcsplit_field_decoder_get_nanoseconds(
+            const char *string,
+            size_t string_length,
+            uint32_t *nanoseconds )
+{
+	size_t string_index = 0;
+	uint32_t value      = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			return( 0 );
+		}
+		if( string_index < 9 )
+		{
+			value *= 10;
+			value += (uint32_t) ( string[ string_index ] - '0' );
+		}
+	}
+	while( string_index < 9 )
+	{
+		value *= 10;
+
+		string_index++;
+	}
+	*nanoseconds = value;
+
+	return( 1 );
+}
+
+/* Removes the trailing zero digits of a decimal
+ */
+static void libcsplit_field_decoder_decimal_trim(
+             libcsplit_field_decoder_decimal_t *decimal )
+{
+	while( ( decimal->number_of_digits > 0 )
+	    && ( decimal->digits[ decimal->number_of_digits - 1 ] == 0 ) )
+	{
+		decimal->number_of_digits--;
+	}
+	if( decimal->number_of_digits == 0 )
+	{
+		decimal->decimal_point = 0;
+	}
+}
+
+/* Multiplies a decimal by 2 to the power of shift
+ * The shift must be in the range 1 - 60, so that the intermediate values fit in 64-bit
+ */
+static void libcsplit_field_decoder_decimal_shift_left(
+             libcsplit_field_decoder_decimal_t *decimal,
+             int shift )
+{
+	uint64_t carry             = 0;
+	uint64_t value             = 0;
+	int digit_index            = 0;
+	int number_of_carry_digits = 0;
+	int write_index            = 0;
+
+	/* Determine the number of digits the value grows by before writing
+	 * any digits, since the digits are converted in place from the end
+	 */
+	for( digit_index = decimal->number_of_digits - 1;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		value = ( (uint64_t) decimal->digits[ digit_index ] << shift ) + carry;
+		carry = value / 10;
+	}
+	while( carry > 0 )
+	{
+		number_of_carry_digits++;
+
+		carry /= 10;
+	}
+	write_index = decimal->number_of_digits + number_of_carry_digits;
+
+	for( digit_index = decimal->number_of_digits - 1;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		value = ( (uint64_t) decimal->digits[ digit_index ] << shift ) + carry;
+		carry = value / 10;
+
+		write_index--;
+
+		if( write_index < LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS )
+		{
+			decimal->digits[ write_index ] = (uint8_t) ( value - ( carry * 10 ) );
+		}
+		else if( value != ( carry * 10 ) )
+		{
+			decimal->is_truncated = 1;
+		}
+	}
+	while( carry > 0 )
+	{
+		value = carry;
+		carry = value / 10;
+
+		write_index--;
+
+		if( write_index < LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS )
+		{
+			decimal->digits[ write_index ] = (uint8_t) ( value - ( carry * 10 ) );
+		}
+		else if( value != ( carry * 10 ) )
+		{
+			decimal->is_truncated = 1;
+		}
+	}
+	decimal->number_of_digits += number_of_carry_digits;
+	decimal->decimal_point    += number_of_carry_digits;
+
+	if( decimal->number_of_digits > LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS )
+	{
+		decimal->number_of_digits = LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS;
+	}
+	libcsplit_field_decoder_decimal_trim(
+	 decimal );
+}
+
+/* Divides a decimal by 2 to the power of shift
+ * The shift must be in the range 1 - 60, so that the intermediate values fit in 64-bit
+ */
+static void libcsplit_field_decoder_decimal_shift_right(
+             libcsplit_field_decoder_decimal_t *decimal,
+             int shift )
+{
+	uint64_t mask   = ( (uint64_t) 1 << shift ) - 1;
+	uint64_t value  = 0;
+	int read_index  = 0;
+	int write_index = 0;
+
+	/* Read digits until the value is at least 2 to the power of shift
+	 */
+	while( ( value >> shift ) == 0 )
+	{
+		if( read_index >= decimal->number_of_digits )
+		{
+			if( value == 0 )
+			{
+				decimal->number_of_digits = 0;
+
+				return;
+			}
+			while( ( value >> shift ) == 0 )
+			{
+				value *= 10;
+
+				read_index++;
+			}
+			break;
+		}
+		value = ( value * 10 ) + decimal->digits[ read_index ];
+
+		read_index++;
+	}
+	decimal->decimal_point -= read_index - 1;
+
+	while( read_index < decimal->number_of_digits )
+	{
+		decimal->digits[ write_index++ ] = (uint8_t) ( value >> shift );
+
+		value = ( ( value & mask ) * 10 ) + decimal->digits[ read_index ];
+
+		read_index++;
+	}
+	while( value > 0 )
+	{
+		if( write_index < LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS )
+		{
+			decimal->digits[ write_index++ ] = (uint8_t) ( value >> shift );
+		}
+		else if( ( value >> shift ) != 0 )
+		{
+			decimal->is_truncated = 1;
+		}
+		value = ( value & mask ) * 10;
+	}
+	decimal->number_of_digits = write_index;
+
+	libcsplit_field_decoder_decimal_trim(
+	 decimal );
+}
+
+/* Multiplies a decimal by 2 to the power of shift, where a negative shift divides
+ */
+static void libcsplit_field_decoder_decimal_shift(
+             libcsplit_field_decoder_decimal_t *decimal,
+             int shift )
+{
+	if( decimal->number_of_digits == 0 )
+	{
+		return;
+	}
+	while( shift > 60 )
+	{
+		libcsplit_field_decoder_decimal_shift_left(
+		 decimal,
+		 60 );
+
+		shift -= 60;
+	}
+	while( shift < -60 )
+	{
+		libcsplit_field_decoder_decimal_shift_right(
+		 decimal,
+		 60 );
+
+		shift += 60;
+	}
+	if( shift > 0 )
+	{
+		libcsplit_field_decoder_decimal_shift_left(
+		 decimal,
+		 shift );
+	}
+	else if( shift < 0 )
+	{
+		libcsplit_field_decoder_decimal_shift_right(
+		 decimal,
+		 -shift );
+	}
+}
+
+/* Retrieves the integer part of a decimal rounded to nearest, ties to even
+ * The integer part must fit in 64-bit
+ */
+static uint64_t libcsplit_field_decoder_decimal_get_rounded_integer(
+                 libcsplit_field_decoder_decimal_t *decimal )
+{
+	uint64_t value  = 0;
+	int digit_index = 0;
+
+	for( digit_index = 0;
+	     digit_index < decimal->decimal_point;
+	     digit_index++ )
+	{
+		value *= 10;
+
+		if( digit_index < decimal->number_of_digits )
+		{
+			value += decimal->digits[ digit_index ];
+		}
+	}
+	if( ( decimal->decimal_point >= 0 )
+	 && ( decimal->decimal_point < decimal->number_of_digits ) )
+	{
+		digit_index = decimal->decimal_point;
+
+		/* When exactly halfway round to even, unless non-zero digits were discarded
+		 */
+		if( ( decimal->digits[ digit_index ] == 5 )
+		 && ( ( digit_index + 1 ) == decimal->number_of_digits ) )
+		{
+			if( ( decimal->is_truncated != 0 )
+			 || ( ( value & 1 ) != 0 ) )
+			{
+				value++;
+			}
+		}
+		else if( decimal->digits[ digit_index ] >= 5 )
+		{
+			value++;
+		}
+	}
+	return( value );
+}
+
+/* Sets a decimal from the digits of a string
+ * The string consists of decimal digits with an optional decimal point
+ * and must have been validated by the caller
+ */
+static void libcsplit_field_decoder_decimal_set(
+             libcsplit_field_decoder_decimal_t *decimal,
+             const char *string,
+             size_t string_length,
+             int exponent )
+{
+	size_t string_index              = 0;
+	int number_of_significant_digits = 0;
+	uint8_t has_point                = 0;
+	char character                   = 0;
+
+	decimal->number_of_digits = 0;
+	decimal->decimal_point    = 0;
+	decimal->is_truncated     = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( character == '.' )
+		{
+			decimal->decimal_point = number_of_significant_digits;
+			has_point              = 1;
+		}
+		else if( ( character == '0' )
+		      && ( number_of_significant_digits == 0 ) )
+		{
+			/* Leading zeros only move the decimal point
+			 */
+			decimal->decimal_point--;
+		}
+		else
+		{
+			if( decimal->number_of_digits < LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS )
+			{
+				decimal->digits[ decimal->number_of_digits++ ] = (uint8_t) ( character - '0' );
+			}
+			else if( character != '0' )
+			{
+				decimal->is_truncated = 1;
+			}
+			number_of_significant_digits++;
+		}
+	}
+	if( has_point == 0 )
+	{
+		decimal->decimal_point = number_of_significant_digits;
+	}
+	decimal->decimal_point += exponent;
+
+	libcsplit_field_decoder_decimal_trim(
+	 decimal );
+}
+
+/* Retrieves the correctly rounded double-precision value of a decimal
+ * The decimal is scaled by powers of 2 into the range [0.5, 1) after which
+ * the 53 bits of the mantissa are extracted, which does not depend on
+ * the floating-point environment or the locale
+ */
+static double libcsplit_field_decoder_decimal_get_double(
+               libcsplit_field_decoder_decimal_t *decimal )
+{
+	/* The number of binary digits a shift by a number of decimal digits can use
+	 */
+	static const int shifts[ 9 ] = {
+		1, 3, 6, 9, 13, 16, 19, 23, 26 };
+
+	byte_stream_float64_t value_float64;
+
+	uint64_t mantissa = 0;
+	int exponent      = 0;
+	int shift         = 0;
+
+	if( ( decimal->number_of_digits == 0 )
+	 || ( decimal->decimal_point < -330 ) )
+	{
+		value_float64.integer = 0;
+
+		return( value_float64.floating_point );
+	}
+	if( decimal->decimal_point > 310 )
+	{
+		value_float64.integer = (uint64_t) 0x7ff0000000000000UL;
+
+		return( value_float64.floating_point );
+	}
+	while( decimal->decimal_point > 0 )
+	{
+		if( decimal->decimal_point >= 9 )
+		{
+			shift = 27;
+		}
+		else
+		{
+			shift = shifts[ decimal->decimal_point ];
+		}
+		libcsplit_field_decoder_decimal_shift(
+		 decimal,
+		 -shift );
+
+		exponent += shift;
+	}
+	while( ( decimal->decimal_point < 0 )
+	    || ( ( decimal->decimal_point == 0 )
+	     &&  ( decimal->digits[ 0 ] < 5 ) ) )
+	{
+		if( -( decimal->decimal_point ) >= 9 )
+		{
+			shift = 27;
+		}
+		else
+		{
+			shift = shifts[ -( decimal->decimal_point ) ];
+		}
+		libcsplit_field_decoder_decimal_shift(
+		 decimal,
+		 shift );
+
+		exponent -= shift;
+	}
+	/* The decimal is in the range [0.5, 1) and a double in the range [1, 2)
+	 */
+	exponent--;
+
+	/* Values below the smallest normal exponent are denormalized
+	 */
+	if( exponent < -1022 )
+	{
+		libcsplit_field_decoder_decimal_shift(
+		 decimal,
+		 exponent + 1022 );
+
+		exponent = -1022;
+	}
+	if( exponent > 1023 )
+	{
+		value_float64.integer = (uint64_t) 0x7ff0000000000000UL;
+
+		return( value_float64.floating_point );
+	}
+	libcsplit_field_decoder_decimal_shift(
+	 decimal,
+	 53 );
+
+	mantissa = libcsplit_field_decoder_decimal_get_rounded_integer(
+	            decimal );
+
+	/* Rounding can carry into an additional bit
+	 */
+	if( mantissa == ( (uint64_t) 1 << 53 ) )
+	{
+		mantissa >>= 1;
+
+		exponent++;
+
+		if( exponent > 1023 )
+		{
+			value_float64.integer = (uint64_t) 0x7ff0000000000000UL;
+
+			return( value_float64.floating_point );
+		}
+	}
+	if( ( mantissa & ( (uint64_t) 1 << 52 ) ) == 0 )
+	{
+		exponent = -1023;
+	}
+	value_float64.integer = ( mantissa & ( ( (uint64_t) 1 << 52 ) - 1 ) )
+	                      | ( (uint64_t) ( exponent + 1023 ) << 52 );
+
+	return( value_float64.floating_point );
+}
+
+/* Decodes an unsigned decimal integer field value
+ * The string consists of 1 to 20 decimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_uint64(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_field_decoder_decode_uint64";
+	size_t string_index   = 0;
+	uint64_t value        = 0;
+	uint32_t digits       = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_length - string_index ) >= 8 )
+	{
+		if( libcsplit_field_decoder_get_eight_digits(
+		     &( string[ string_index ] ),
+		     &digits ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		if( value > ( ( UINT64_MAX - digits ) / 100000000UL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		value *= 100000000UL;
+		value += digits;
+
+		string_index += 8;
+	}
+	while( string_index < string_length )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		digits = (uint32_t) ( string[ string_index ] - '0' );
+
+		if( value > ( ( UINT64_MAX - digits ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		value *= 10;
+		value += digits;
+
+		string_index++;
+	}
+	*value_64bit = value;
+
+	return( 1 );
+}
+
+/* Decodes a signed decimal integer field value
+ * The string consists of an optional sign followed by 1 to 20 decimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_int64(
+     const char *string,
+     size_t string_length,
+     int64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_field_decoder_decode_int64";
+	size_t string_index   = 0;
+	uint64_t value        = 0;
+	uint8_t is_negative   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > 0 )
+	{
+		if( string[ 0 ] == '-' )
+		{
+			is_negative  = 1;
+			string_index = 1;
+		}
+		else if( string[ 0 ] == '+' )
+		{
+			string_index = 1;
+		}
+	}
+	if( libcsplit_field_decoder_decode_uint64(
+	     &( string[ string_index ] ),
+	     string_length - string_index,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to decode digits.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_negative == 0 )
+	 && ( value > (uint64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( is_negative != 0 )
+	 && ( value > ( (uint64_t) INT64_MAX + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: value exceeds minimum.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative == 0 )
+	{
+		*value_64bit = (int64_t) value;
+	}
+	else if( value > (uint64_t) INT64_MAX )
+	{
+		*value_64bit = -INT64_MAX - 1;
+	}
+	else
+	{
+		*value_64bit = -( (int64_t) value );
+	}
+	return( 1 );
+}
+
+/* Decodes a hexadecimal integer field value
+ * The string consists of an optional 0x or 0X prefix followed by 1 to 16 hexadecimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_hexadecimal(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_field_decoder_decode_hexadecimal";
+	size_t string_index   = 0;
+	uint64_t value        = 0;
+	char character        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length >= 2 )
+	 && ( string[ 0 ] == '0' )
+	 && ( ( string[ 1 ] == 'x' )
+	  ||  ( string[ 1 ] == 'X' ) ) )
+	{
+		string_index = 2;
+	}
+	if( ( string_length == string_index )
+	 || ( ( string_length - string_index ) > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < string_length )
+	{
+		character = string[ string_index++ ];
+
+		value <<= 4;
+
+		if( ( character >= '0' )
+		 && ( character <= '9' ) )
+		{
+			value |= (uint64_t) ( character - '0' );
+		}
+		else if( ( character >= 'A' )
+		      && ( character <= 'F' ) )
+		{
+			value |= (uint64_t) ( character - 'A' + 10 );
+		}
+		else if( ( character >= 'a' )
+		      && ( character <= 'f' ) )
+		{
+			value |= (uint64_t) ( character - 'a' + 10 );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_64bit = value;
+
+	return( 1 );
+}
+
+/* Decodes a floating-point field value
+ * The string consists of an optional sign, decimal digits with an optional
+ * decimal point and an optional exponent, such as -12.5e-3
+ * Values with at most 19 significant digits and a mantissa and power of 10 that
+ * are exactly representable as a double are determined with a single multiplication
+ * or division, other values are determined with decimal arithmetic on the digits.
+ * Both are correctly rounded, independent of the locale and read the string in place
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_double(
+     const char *string,
+     size_t string_length,
+     double *value_double,
+     libcerror_error_t **error )
+{
+	libcsplit_field_decoder_decimal_t decimal;
+
+	static char *function            = "libcsplit_field_decoder_decode_double";
+	size_t mantissa_end              = 0;
+	size_t mantissa_start            = 0;
+	size_t string_index              = 0;
+	uint64_t mantissa                = 0;
+	double value                     = 0.0;
+	int exponent                     = 0;
+	int exponent_value               = 0;
+	int number_of_digits             = 0;
+	int number_of_exponent_digits    = 0;
+	int number_of_significant_digits = 0;
+	uint8_t is_negative              = 0;
+	uint8_t is_negative_exponent     = 0;
+	uint8_t is_truncated             = 0;
+	char character                   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_double == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value double.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > 0 )
+	{
+		if( string[ 0 ] == '-' )
+		{
+			is_negative  = 1;
+			string_index = 1;
+		}
+		else if( string[ 0 ] == '+' )
+		{
+			string_index = 1;
+		}
+	}
+	mantissa_start = string_index;
+
+	/* Only the first 19 significant digits fit in the mantissa
+	 */
+	while( string_index < string_length )
+	{
+		character = string[ string_index ];
+
+		if( ( character < '0' )
+		 || ( character > '9' ) )
+		{
+			break;
+		}
+		if( number_of_significant_digits < 19 )
+		{
+			mantissa = ( mantissa * 10 ) + (uint64_t) ( character - '0' );
+
+			if( mantissa != 0 )
+			{
+				number_of_significant_digits++;
+			}
+		}
+		else
+		{
+			if( character != '0' )
+			{
+				is_truncated = 1;
+			}
+			exponent++;
+		}
+		number_of_digits++;
+
+		string_index++;
+	}
+	if( ( string_index < string_length )
+	 && ( string[ string_index ] == '.' ) )
+	{
+		string_index++;
+
+		while( string_index < string_length )
+		{
+			character = string[ string_index ];
+
+			if( ( character < '0' )
+			 || ( character > '9' ) )
+			{
+				break;
+			}
+			if( number_of_significant_digits < 19 )
+			{
+				mantissa = ( mantissa * 10 ) + (uint64_t) ( character - '0' );
+
+				if( mantissa != 0 )
+				{
+					number_of_significant_digits++;
+				}
+				exponent--;
+			}
+			else if( character != '0' )
+			{
+				is_truncated = 1;
+			}
+			number_of_digits++;
+
+			string_index++;
+		}
+	}
+	if( number_of_digits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: missing digits in string.",
+		 function );
+
+		return( -1 );
+	}
+	mantissa_end = string_index;
+
+	if( ( string_index < string_length )
+	 && ( ( string[ string_index ] == 'e' )
+	  ||  ( string[ string_index ] == 'E' ) ) )
+	{
+		string_index++;
+
+		if( string_index < string_length )
+		{
+			if( string[ string_index ] == '-' )
+			{
+				is_negative_exponent = 1;
+
+				string_index++;
+			}
+			else if( string[ string_index ] == '+' )
+			{
+				string_index++;
+			}
+		}
+		while( string_index < string_length )
+		{
+			character = string[ string_index ];
+
+			if( ( character < '0' )
+			 || ( character > '9' ) )
+			{
+				break;
+			}
+			/* Larger exponents result in an infinite value or 0 regardless
+			 */
+			if( exponent_value < 100000 )
+			{
+				exponent_value = ( exponent_value * 10 ) + ( character - '0' );
+			}
+			number_of_exponent_digits++;
+
+			string_index++;
+		}
+		if( number_of_exponent_digits == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: missing exponent digits in string.",
+			 function );
+
+			return( -1 );
+		}
+		if( is_negative_exponent != 0 )
+		{
+			exponent_value = -exponent_value;
+		}
+		exponent += exponent_value;
+	}
+	if( string_index < string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unsupported character in string.",
+		 function );
+
+		return( -1 );
+	}
+	if( mantissa == 0 )
+	{
+		value = 0.0;
+	}
+	else if( ( is_truncated == 0 )
+	      && ( mantissa <= ( (uint64_t) 1 << 53 ) )
+	      && ( exponent >= -22 )
+	      && ( exponent <= 22 ) )
+	{
+		/* Both the mantissa and the power of 10 are exact, hence a single
+		 * multiplication or division is correctly rounded
+		 */
+		value = (double) mantissa;
+
+		if( exponent < 0 )
+		{
+			value /= libcsplit_field_decoder_powers_of_10[ -exponent ];
+		}
+		else
+		{
+			value *= libcsplit_field_decoder_powers_of_10[ exponent ];
+		}
+	}
+	else
+	{
+		libcsplit_field_decoder_decimal_set(
+		 &decimal,
+		 &( string[ mantissa_start ] ),
+		 mantissa_end - mantissa_start,
+		 exponent_value );
+
+		value = libcsplit_field_decoder_decimal_get_double(
+		         &decimal );
+	}
+	if( is_negative != 0 )
+	{
+		value = -value;
+	}
+	*value_double = value;
+
+	return( 1 );
+}
+
+/* Decodes an epoch timestamp field value
+ * The string consists of an optional sign, the number of seconds since
+ * January 1, 1970 00:00:00 UTC and an optional fraction of a second, such as 1700000000.25
+ * The timestamp is the number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_epoch_timestamp(
+     const char *string,
+     size_t string_length,
+     int64_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_field_decoder_decode_epoch_timestamp";
+	size_t seconds_end    = 0;
+	size_t string_index   = 0;
+	uint64_t seconds      = 0;
+	uint64_t value        = 0;
+	uint32_t nanoseconds  = 0;
+	uint8_t is_negative   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > 0 )
+	{
+		if( string[ 0 ] == '-' )
+		{
+			is_negative  = 1;
+			string_index = 1;
+		}
+		else if( string[ 0 ] == '+' )
+		{
+			string_index = 1;
+		}
+	}
+	for( seconds_end = string_index;
+	     seconds_end < string_length;
+	     seconds_end++ )
+	{
+		if( string[ seconds_end ] == '.' )
+		{
+			break;
+		}
+	}
+	if( libcsplit_field_decoder_decode_uint64(
+	     &( string[ string_index ] ),
+	     seconds_end - string_index,
+	     &seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to decode seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( seconds_end < string_length )
+	{
+		if( ( ( string_length - seconds_end ) < 2 )
+		 || ( libcsplit_field_decoder_get_nanoseconds(
+		       &( string[ seconds_end + 1 ] ),
+		       string_length - ( seconds_end + 1 ),
+		       &nanoseconds ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unsupported fraction of second in string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( seconds > ( (uint64_t) INT64_MAX / 1000000000UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value = ( seconds * 1000000000UL ) + nanoseconds;
+
+	if( value > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: timestamp value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_negative != 0 )
+	{
+		*timestamp = -( (int64_t) value );
+	}
+	else
+	{
+		*timestamp = (int64_t) value;
+	}
+	return( 1 );
+}
+
+/* Decodes an ISO 8601 timestamp field value
+ * The string consists of a date in the form YYYY-MM-DD, optionally followed by
+ * a time in the form Thh:mm[:ss[.fraction]] and a time zone in the form Z or +hh[:]mm,
+ * where a space can be used instead of the T. A timestamp without time zone is considered UTC
+ * The timestamp is the number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_iso8601_timestamp(
+     const char *string,
+     size_t string_length,
+     int64_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcsplit_field_decoder_decode_iso8601_timestamp";
+	size_t fraction_start    = 0;
+	size_t minutes_index     = 0;
+	size_t string_index      = 0;
+	int64_t calendar_year    = 0;
+	int64_t day_of_era       = 0;
+	int64_t day_of_year      = 0;
+	int64_t days             = 0;
+	int64_t era              = 0;
+	int64_t seconds          = 0;
+	int64_t year_of_era      = 0;
+	uint32_t day             = 0;
+	uint32_t hours           = 0;
+	uint32_t minutes         = 0;
+	uint32_t month           = 0;
+	uint32_t nanoseconds     = 0;
+	uint32_t number_of_days  = 0;
+	uint32_t offset_hours    = 0;
+	uint32_t offset_minutes  = 0;
+	uint32_t time_seconds    = 0;
+	uint32_t time_of_minute  = 0;
+	uint32_t year            = 0;
+	int32_t offset_seconds   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length < 10 )
+	 || ( string[ 4 ] != '-' )
+	 || ( string[ 7 ] != '-' )
+	 || ( libcsplit_field_decoder_get_digits(
+	       string,
+	       4,
+	       &year ) != 1 )
+	 || ( libcsplit_field_decoder_get_digits(
+	       &( string[ 5 ] ),
+	       2,
+	       &month ) != 1 )
+	 || ( libcsplit_field_decoder_get_digits(
+	       &( string[ 8 ] ),
+	       2,
+	       &day ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unsupported date in string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( month >= 1 )
+	 && ( month <= 12 ) )
+	{
+		number_of_days = libcsplit_field_decoder_days_per_month[ month - 1 ];
+
+		if( ( month == 2 )
+		 && ( ( year % 4 ) == 0 )
+		 && ( ( ( year % 100 ) != 0 )
+		  ||  ( ( year % 400 ) == 0 ) ) )
+		{
+			number_of_days++;
+		}
+	}
+	if( ( day < 1 )
+	 || ( day > number_of_days ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: date value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = 10;
+
+	if( string_index < string_length )
+	{
+		if( ( ( string[ string_index ] != 'T' )
+		  &&  ( string[ string_index ] != 't' )
+		  &&  ( string[ string_index ] != ' ' ) )
+		 || ( ( string_length - string_index ) < 6 )
+		 || ( string[ string_index + 3 ] != ':' )
+		 || ( libcsplit_field_decoder_get_digits(
+		       &( string[ string_index + 1 ] ),
+		       2,
+		       &hours ) != 1 )
+		 || ( libcsplit_field_decoder_get_digits(
+		       &( string[ string_index + 4 ] ),
+		       2,
+		       &minutes ) != 1 )
+		 || ( hours > 23 )
+		 || ( minutes > 59 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unsupported time in string.",
+			 function );
+
+			return( -1 );
+		}
+		time_seconds  = ( hours * 3600 ) + ( minutes * 60 );
+		string_index += 6;
+
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] == ':' ) )
+		{
+			if( ( ( string_length - string_index ) < 3 )
+			 || ( libcsplit_field_decoder_get_digits(
+			       &( string[ string_index + 1 ] ),
+			       2,
+			       &time_of_minute ) != 1 )
+			 || ( time_of_minute > 59 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unsupported seconds in string.",
+				 function );
+
+				return( -1 );
+			}
+			time_seconds += time_of_minute;
+			string_index += 3;
+
+			if( ( string_index < string_length )
+			 && ( ( string[ string_index ] == '.' )
+			  ||  ( string[ string_index ] == ',' ) ) )
+			{
+				string_index++;
+
+				fraction_start = string_index;
+
+				while( ( string_index < string_length )
+				    && ( string[ string_index ] >= '0' )
+				    && ( string[ string_index ] <= '9' ) )
+				{
+					string_index++;
+				}
+				if( ( string_index == fraction_start )
+				 || ( libcsplit_field_decoder_get_nanoseconds(
+				       &( string[ fraction_start ] ),
+				       string_index - fraction_start,
+				       &nanoseconds ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+					 "%s: unsupported fraction of second in string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		if( string_index < string_length )
+		{
+			if( ( string[ string_index ] == 'Z' )
+			 || ( string[ string_index ] == 'z' ) )
+			{
+				string_index++;
+			}
+			else if( ( string[ string_index ] == '+' )
+			      || ( string[ string_index ] == '-' ) )
+			{
+				if( ( ( string_length - string_index ) >= 6 )
+				 && ( string[ string_index + 3 ] == ':' ) )
+				{
+					minutes_index = string_index + 4;
+				}
+				else
+				{
+					minutes_index = string_index + 3;
+				}
+				if( ( ( string_length - minutes_index ) != 2 )
+				 || ( libcsplit_field_decoder_get_digits(
+				       &( string[ string_index + 1 ] ),
+				       2,
+				       &offset_hours ) != 1 )
+				 || ( libcsplit_field_decoder_get_digits(
+				       &( string[ minutes_index ] ),
+				       2,
+				       &offset_minutes ) != 1 )
+				 || ( offset_hours > 23 )
+				 || ( offset_minutes > 59 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+					 "%s: unsupported time zone in string.",
+					 function );
+
+					return( -1 );
+				}
+				offset_seconds = (int32_t) ( ( offset_hours * 3600 ) + ( offset_minutes * 60 ) );
+
+				if( string[ string_index ] == '-' )
+				{
+					offset_seconds = -offset_seconds;
+				}
+				string_index = string_length;
+			}
+		}
+	}
+	if( string_index < string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unsupported character in string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the number of days since January 1, 1970 using eras of 400 years
+	 * that start at March 1, so that the leap day is the last day of a year
+	 */
+	calendar_year = (int64_t) year;
+
+	if( month <= 2 )
+	{
+		calendar_year -= 1;
+		month         += 9;
+	}
+	else
+	{
+		month -= 3;
+	}
+	if( calendar_year >= 0 )
+	{
+		era = calendar_year / 400;
+	}
+	else
+	{
+		era = ( calendar_year - 399 ) / 400;
+	}
+	year_of_era = calendar_year - ( era * 400 );
+	day_of_year = ( ( ( 153 * (int64_t) month ) + 2 ) / 5 ) + day - 1;
+	day_of_era  = ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) + day_of_year;
+	days        = ( era * 146097 ) + day_of_era - 719468;
+
+	seconds = ( days * 86400 ) + (int64_t) time_seconds - offset_seconds;
+
+	/* The timestamp supports dates between 1677-09-21 and 2262-04-11
+	 */
+	if( ( seconds < -( (int64_t) 9223372036L ) )
+	 || ( seconds > (int64_t) 9223372036L )
+	 || ( ( seconds == (int64_t) 9223372036L )
+	  &&  ( nanoseconds > 854775807UL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: timestamp value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( seconds * 1000000000L ) + (int64_t) nanoseconds;
+
+	return( 1 );
+}
+
+/* Decodes a field value of a specific field type
+ * The value is stored in host byte order as an int64_t for the integer and timestamp
+ * field types, as an uint64_t for the unsigned and hexadecimal field types and as a double
+ * for the floating-point field type. The value data does not need to be aligned
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_field_decoder_decode_value(
+     const char *string,
+     size_t string_length,
+     uint8_t field_type,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_field_decoder_decode_value";
+	double value_double   = 0.0;
+	uint64_t value_64bit  = 0;
+	int64_t signed_value  = 0;
+	int result            = 0;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size < LIBCSPLIT_FIELD_DECODER_VALUE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	switch( field_type )
+	{
+		case LIBCSPLIT_FIELD_TYPE_INT64:
+			result = libcsplit_field_decoder_decode_int64(
+			          string,
+			          string_length,
+			          &signed_value,
+			          error );
+			break;
+
+		case LIBCSPLIT_FIELD_TYPE_UINT64:
+			result = libcsplit_field_decoder_decode_uint64(
+			          string,
+			          string_length,
+			          &value_64bit,
+			          error );
+			break;
+
+		case LIBCSPLIT_FIELD_TYPE_HEXADECIMAL:
+			result = libcsplit_field_decoder_decode_hexadecimal(
+			          string,
+			          string_length,
+			          &value_64bit,
+			          error );
+			break;
+
+		case LIBCSPLIT_FIELD_TYPE_DOUBLE:
+			result = libcsplit_field_decoder_decode_double(
+			          string,
+			          string_length,
+			          &value_double,
+			          error );
+			break;
+
+		case LIBCSPLIT_FIELD_TYPE_TIMESTAMP_EPOCH:
+			result = libcsplit_field_decoder_decode_epoch_timestamp(
+			          string,
+			          string_length,
+			          &signed_value,
+			          error );
+			break;
+
+		case LIBCSPLIT_FIELD_TYPE_TIMESTAMP_ISO8601:
+			result = libcsplit_field_decoder_decode_iso8601_timestamp(
+			          string,
+			          string_length,
+			          &signed_value,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field type: %" PRIu8 ".",
+			 function,
+			 field_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to decode value.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_type == LIBCSPLIT_FIELD_TYPE_DOUBLE )
+	{
+		result = ( memory_copy(
+		            value_data,
+		            &value_double,
+		            sizeof( double ) ) != NULL );
+	}
+	else if( ( field_type == LIBCSPLIT_FIELD_TYPE_UINT64 )
+	      || ( field_type == LIBCSPLIT_FIELD_TYPE_HEXADECIMAL ) )
+	{
+		result = ( memory_copy(
+		            value_data,
+		            &value_64bit,
+		            sizeof( uint64_t ) ) != NULL );
+	}
+	else
+	{
+		result = ( memory_copy(
+		            value_data,
+		            &signed_value,
+		            sizeof( int64_t ) ) != NULL );
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,116 @@
+/*
+ * Field decoder functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_FIELD_DECODER_H )
+#define _LIBCSPLIT_FIELD_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a decoded field value
+ */
+#define LIBCSPLIT_FIELD_DECODER_VALUE_SIZE	8
+
+/* The maximum number of digits of a decimal, which suffices to correctly
+ * round any floating-point value that has more digits
+ */
+#define LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS	800
+
+typedef struct libcsplit_field_decoder_decimal libcsplit_field_decoder_decimal_t;
+
+/* The decimal used to determine a correctly rounded floating-point value
+ * The value is 0.digits multiplied by 10 to the power of the decimal point
+ */
+struct libcsplit_field_decoder_decimal
+{
+	/* The digits, where every digit has a value of 0 - 9
+	 */
+	uint8_t digits[ LIBCSPLIT_FIELD_DECODER_DECIMAL_MAXIMUM_NUMBER_OF_DIGITS ];
+
+	/* The number of digits
+	 */
+	int number_of_digits;
+
+	/* The position of the decimal point relative to the first digit
+	 */
+	int decimal_point;
+
+	/* Value to indicate non-zero digits were discarded
+	 */
+	uint8_t is_truncated;
+};
+
+int libcsplit_field_decoder_decode_uint64(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_int64(
+     const char *string,
+     size_t string_length,
+     int64_t *value_64bit,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_hexadecimal(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_double(
+     const char *string,
+     size_t string_length,
+     double *value_double,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_epoch_timestamp(
+     const char *string,
+     size_t string_length,
+     int64_t *timestamp,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_iso8601_timestamp(
+     const char *string,
+     size_t string_length,
+     int64_t *timestamp,
+     libcerror_error_t **error );
+
+int libcsplit_field_decoder_decode_value(
+     const char *string,
+     size_t string_length,
+     uint8_t field_type,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_FIELD_DECODER_H ) */
+
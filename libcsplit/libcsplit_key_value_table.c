@@ -0,0 +1,774 @@
+/*
+ * Key value table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_key_value_table.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+/* Creates a key value table
+ * The key value table contains a copy of the string, that is terminated at
+ * the last character, into which the keys and values point
+ * Make sure the value key_value_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_initialize(
+     libcsplit_key_value_table_t **key_value_table,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	static char *function                                          = "libcsplit_key_value_table_initialize";
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_value_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = memory_allocate_structure(
+	                            libcsplit_internal_key_value_table_t );
+
+	if( internal_key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key value table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_key_value_table,
+	     0,
+	     sizeof( libcsplit_internal_key_value_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key value table.",
+		 function );
+
+		memory_free(
+		 internal_key_value_table );
+
+		return( -1 );
+	}
+	internal_key_value_table->string = (char *) memory_allocate(
+	                                             sizeof( char ) * string_size );
+
+	if( internal_key_value_table->string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_key_value_table->string,
+	     string,
+	     sizeof( char ) * ( string_size - 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_key_value_table->string[ string_size - 1 ] = 0;
+	internal_key_value_table->string_size               = string_size;
+
+	*key_value_table = (libcsplit_key_value_table_t *) internal_key_value_table;
+
+	return( 1 );
+
+on_error:
+	if( internal_key_value_table != NULL )
+	{
+		if( internal_key_value_table->string != NULL )
+		{
+			memory_free(
+			 internal_key_value_table->string );
+		}
+		memory_free(
+		 internal_key_value_table );
+	}
+	return( -1 );
+}
+
+/* Frees a key value table
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_free(
+     libcsplit_key_value_table_t **key_value_table,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	static char *function                                          = "libcsplit_key_value_table_free";
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_value_table != NULL )
+	{
+		internal_key_value_table = (libcsplit_internal_key_value_table_t *) *key_value_table;
+		*key_value_table         = NULL;
+
+		if( internal_key_value_table->hash_index != NULL )
+		{
+			memory_free(
+			 internal_key_value_table->hash_index );
+		}
+		if( internal_key_value_table->pairs != NULL )
+		{
+			memory_free(
+			 internal_key_value_table->pairs );
+		}
+		if( internal_key_value_table->string != NULL )
+		{
+			memory_free(
+			 internal_key_value_table->string );
+		}
+		memory_free(
+		 internal_key_value_table );
+	}
+	return( 1 );
+}
+
+/* Calculates the 32-bit FNV-1a hash of a key
+ * Returns the hash
+ */
+static uint32_t libcsplit_key_value_table_get_hash(
+                 const char *key,
+                 size_t key_length )
+{
+	size_t key_index = 0;
+	uint32_t hash    = 0x811c9dc5UL;
+
+	for( key_index = 0;
+	     key_index < key_length;
+	     key_index++ )
+	{
+		hash ^= (uint8_t) key[ key_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Determines if a pair has a specific key
+ * Returns 1 if the key matches or 0 if not
+ */
+static int libcsplit_key_value_table_pair_has_key(
+            libcsplit_key_value_pair_t *pair,
+            const char *key,
+            size_t key_length )
+{
+	if( ( pair->key_size - 1 ) != key_length )
+	{
+		return( 0 );
+	}
+	if( key_length == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_compare(
+	     pair->key,
+	     key,
+	     key_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends a pair
+ * The key and value must point into the string of the key value table and
+ * their sizes include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_append_pair(
+     libcsplit_key_value_table_t *key_value_table,
+     char *key,
+     size_t key_size,
+     char *value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	libcsplit_key_value_pair_t *reallocated_pairs                  = NULL;
+	static char *function                                          = "libcsplit_key_value_table_append_pair";
+	int number_of_pairs                                            = 0;
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) key_value_table;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > internal_key_value_table->string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_size == 0 )
+	 || ( value_size > internal_key_value_table->string_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_value_table->number_of_pairs >= internal_key_value_table->maximum_number_of_pairs )
+	{
+		if( internal_key_value_table->maximum_number_of_pairs == 0 )
+		{
+			number_of_pairs = 16;
+		}
+		else if( internal_key_value_table->maximum_number_of_pairs > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of pairs value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_pairs = internal_key_value_table->maximum_number_of_pairs * 2;
+		}
+		reallocated_pairs = (libcsplit_key_value_pair_t *) memory_reallocate(
+		                                                    internal_key_value_table->pairs,
+		                                                    sizeof( libcsplit_key_value_pair_t ) * number_of_pairs );
+
+		if( reallocated_pairs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize pairs.",
+			 function );
+
+			return( -1 );
+		}
+		internal_key_value_table->pairs                   = reallocated_pairs;
+		internal_key_value_table->maximum_number_of_pairs = number_of_pairs;
+	}
+	number_of_pairs = internal_key_value_table->number_of_pairs;
+
+	internal_key_value_table->pairs[ number_of_pairs ].key        = key;
+	internal_key_value_table->pairs[ number_of_pairs ].key_size   = key_size;
+	internal_key_value_table->pairs[ number_of_pairs ].value      = value;
+	internal_key_value_table->pairs[ number_of_pairs ].value_size = value_size;
+
+	internal_key_value_table->number_of_pairs += 1;
+
+	return( 1 );
+}
+
+/* Builds the hash index
+ * The hash index is an open addressing hash table with linear probing, that
+ * contains at least twice as many slots as there are pairs. If a key occurs
+ * more than once the first pair with the key is indexed
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_build_hash_index(
+     libcsplit_key_value_table_t *key_value_table,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	libcsplit_key_value_pair_t *pair                               = NULL;
+	static char *function                                          = "libcsplit_key_value_table_build_hash_index";
+	uint32_t hash_index_size                                       = 16;
+	uint32_t slot_index                                            = 0;
+	int pair_index                                                 = 0;
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) key_value_table;
+
+	if( internal_key_value_table->hash_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value table - hash index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_value_table->number_of_pairs > (int) ( ( (uint32_t) 1 << 30 ) / sizeof( int ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key value table - number of pairs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( hash_index_size < ( (uint32_t) internal_key_value_table->number_of_pairs * 2 ) )
+	{
+		hash_index_size <<= 1;
+	}
+	internal_key_value_table->hash_index = (int *) memory_allocate(
+	                                                sizeof( int ) * hash_index_size );
+
+	if( internal_key_value_table->hash_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte set to 0xff marks every slot as empty (-1)
+	 */
+	if( memory_set(
+	     internal_key_value_table->hash_index,
+	     0xff,
+	     sizeof( int ) * hash_index_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash index.",
+		 function );
+
+		memory_free(
+		 internal_key_value_table->hash_index );
+
+		internal_key_value_table->hash_index = NULL;
+
+		return( -1 );
+	}
+	internal_key_value_table->hash_index_size = hash_index_size;
+
+	for( pair_index = 0;
+	     pair_index < internal_key_value_table->number_of_pairs;
+	     pair_index++ )
+	{
+		pair = &( internal_key_value_table->pairs[ pair_index ] );
+
+		slot_index = libcsplit_key_value_table_get_hash(
+		              pair->key,
+		              pair->key_size - 1 );
+
+		slot_index &= hash_index_size - 1;
+
+		while( internal_key_value_table->hash_index[ slot_index ] != -1 )
+		{
+			if( libcsplit_key_value_table_pair_has_key(
+			     &( internal_key_value_table->pairs[ internal_key_value_table->hash_index[ slot_index ] ] ),
+			     pair->key,
+			     pair->key_size - 1 ) != 0 )
+			{
+				break;
+			}
+			slot_index = ( slot_index + 1 ) & ( hash_index_size - 1 );
+		}
+		if( internal_key_value_table->hash_index[ slot_index ] == -1 )
+		{
+			internal_key_value_table->hash_index[ slot_index ] = pair_index;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of pairs
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_get_number_of_pairs(
+     libcsplit_key_value_table_t *key_value_table,
+     int *number_of_pairs,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	static char *function                                          = "libcsplit_key_value_table_get_number_of_pairs";
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) key_value_table;
+
+	if( number_of_pairs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pairs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pairs = internal_key_value_table->number_of_pairs;
+
+	return( 1 );
+}
+
+/* Retrieves a specific pair
+ * The key and value point into the key value table and their sizes include
+ * the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_key_value_table_get_pair_by_index(
+     libcsplit_key_value_table_t *key_value_table,
+     int pair_index,
+     char **key,
+     size_t *key_size,
+     char **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	static char *function                                          = "libcsplit_key_value_table_get_pair_by_index";
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) key_value_table;
+
+	if( ( pair_index < 0 )
+	 || ( pair_index >= internal_key_value_table->number_of_pairs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pair index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	*key        = internal_key_value_table->pairs[ pair_index ].key;
+	*key_size   = internal_key_value_table->pairs[ pair_index ].key_size;
+	*value      = internal_key_value_table->pairs[ pair_index ].value;
+	*value_size = internal_key_value_table->pairs[ pair_index ].value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a specific key
+ * The key does not need to be terminated by an end-of-string character
+ * If a key occurs more than once the value of the first pair with the key
+ * is retrieved. The hash index is used if it was built otherwise the pairs
+ * are searched in order
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libcsplit_key_value_table_get_value_by_key(
+     libcsplit_key_value_table_t *key_value_table,
+     const char *key,
+     size_t key_length,
+     char **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	libcsplit_key_value_pair_t *pair                               = NULL;
+	static char *function                                          = "libcsplit_key_value_table_get_value_by_key";
+	uint32_t slot_index                                            = 0;
+	int pair_index                                                 = 0;
+
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) key_value_table;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key_value_table->hash_index != NULL )
+	{
+		slot_index = libcsplit_key_value_table_get_hash(
+		              key,
+		              key_length );
+
+		slot_index &= internal_key_value_table->hash_index_size - 1;
+
+		/* The hash index always contains empty slots hence probing ends
+		 */
+		while( internal_key_value_table->hash_index[ slot_index ] != -1 )
+		{
+			pair = &( internal_key_value_table->pairs[ internal_key_value_table->hash_index[ slot_index ] ] );
+
+			if( libcsplit_key_value_table_pair_has_key(
+			     pair,
+			     key,
+			     key_length ) != 0 )
+			{
+				*value      = pair->value;
+				*value_size = pair->value_size;
+
+				return( 1 );
+			}
+			slot_index = ( slot_index + 1 ) & ( internal_key_value_table->hash_index_size - 1 );
+		}
+		return( 0 );
+	}
+	for( pair_index = 0;
+	     pair_index < internal_key_value_table->number_of_pairs;
+	     pair_index++ )
+	{
+		pair = &( internal_key_value_table->pairs[ pair_index ] );
+
+		if( libcsplit_key_value_table_pair_has_key(
+		     pair,
+		     key,
+		     key_length ) != 0 )
+		{
+			*value      = pair->value;
+			*value_size = pair->value_size;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Key value table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_INTERNAL_KEY_VALUE_TABLE_H )
+#define _LIBCSPLIT_INTERNAL_KEY_VALUE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcsplit_key_value_pair libcsplit_key_value_pair_t;
+
+struct libcsplit_key_value_pair
+{
+	/* The key
+	 */
+	char *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The value
+	 */
+	char *value;
+
+	/* The value size
+	 */
+	size_t value_size;
+};
+
+typedef struct libcsplit_internal_key_value_table libcsplit_internal_key_value_table_t;
+
+struct libcsplit_internal_key_value_table
+{
+	/* The string
+	 */
+	char *string;
+
+	/* The string size
+	 */
+	size_t string_size;
+
+	/* The number of pairs
+	 */
+	int number_of_pairs;
+
+	/* The maximum number of pairs
+	 */
+	int maximum_number_of_pairs;
+
+	/* The pairs
+	 */
+	libcsplit_key_value_pair_t *pairs;
+
+	/* The hash index
+	 * contains the index of a pair per slot or -1 if the slot is empty
+	 */
+	int *hash_index;
+
+	/* The number of slots in the hash index
+	 * this is a power of 2
+	 */
+	uint32_t hash_index_size;
+};
+
+int libcsplit_key_value_table_initialize(
+     libcsplit_key_value_table_t **key_value_table,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_key_value_table_free(
+     libcsplit_key_value_table_t **key_value_table,
+     libcerror_error_t **error );
+
+int libcsplit_key_value_table_append_pair(
+     libcsplit_key_value_table_t *key_value_table,
+     char *key,
+     size_t key_size,
+     char *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+int libcsplit_key_value_table_build_hash_index(
+     libcsplit_key_value_table_t *key_value_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_key_value_table_get_number_of_pairs(
+     libcsplit_key_value_table_t *key_value_table,
+     int *number_of_pairs,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_key_value_table_get_pair_by_index(
+     libcsplit_key_value_table_t *key_value_table,
+     int pair_index,
+     char **key,
+     size_t *key_size,
+     char **value,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_key_value_table_get_value_by_key(
+     libcsplit_key_value_table_t *key_value_table,
+     const char *key,
+     size_t key_length,
+     char **value,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_INTERNAL_KEY_VALUE_TABLE_H ) */
+
@@ -0,0 +1,243 @@
+/*
+ * Narrow character file functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcsplit_definitions.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_narrow_file.h"
+#include "libcsplit_narrow_split_string.h"
+#include "libcsplit_types.h"
+
+/* Splits a narrow character file
+ * The file is mapped read-only into memory and the segments reference the mapping,
+ * which is owned by the split string and unmapped when the split string is freed.
+ * Since the mapping is not modified the segments are not terminated and their sizes
+ * do not include an end-of-string character. The end-of-string character has no
+ * special meaning in the file data. The split string has the
+ * LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED and LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY
+ * flags set.
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_file_split(
+     const char *filename,
+     char delimiter,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	libcsplit_mapped_file_t *mapped_file                            = NULL;
+	char *data_end                                                  = NULL;
+	char *segment_end                                               = NULL;
+	char *segment_start                                             = NULL;
+	static char *function                                           = "libcsplit_narrow_file_split";
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcsplit_mapped_file_open(
+	     mapped_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* An empty file has no segments
+	 */
+	if( mapped_file->data_size == 0 )
+	{
+		if( libcsplit_mapped_file_free(
+		     &mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* Determine the number of segments
+	 */
+	segment_start = (char *) mapped_file->data;
+	data_end      = &( segment_start[ mapped_file->data_size ] );
+
+	number_of_segments = 1;
+
+	while( segment_start < data_end )
+	{
+		segment_end = narrow_string_search_character(
+		               segment_start,
+		               delimiter,
+		               (size_t) ( data_end - segment_start ) );
+
+		if( segment_end == NULL )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_segments++;
+
+		segment_start = segment_end + 1;
+	}
+	if( libcsplit_narrow_split_string_initialize(
+	     split_string,
+	     NULL,
+	     0,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	/* The split string takes over the mapping
+	 */
+	internal_split_string->string      = (char *) mapped_file->data;
+	internal_split_string->string_size = mapped_file->data_size;
+	internal_split_string->mapped_file = mapped_file;
+	internal_split_string->flags       = LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED | LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY;
+
+	mapped_file = NULL;
+
+	/* Determine the segments
+	 * the empty segment after a trailing delimiter references the end of the data
+	 */
+	segment_start = internal_split_string->string;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_end = NULL;
+
+		if( segment_start < data_end )
+		{
+			segment_end = narrow_string_search_character(
+			               segment_start,
+			               delimiter,
+			               (size_t) ( data_end - segment_start ) );
+		}
+		if( segment_end == NULL )
+		{
+			segment_end = data_end;
+		}
+		internal_split_string->segments[ segment_index ]      = segment_start;
+		internal_split_string->segment_sizes[ segment_index ] = (size_t) ( segment_end - segment_start );
+
+		segment_start = segment_end + 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	if( mapped_file != NULL )
+	{
+		libcsplit_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,48 @@
+/*
+ * Narrow character file functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_NARROW_FILE_H )
+#define _LIBCSPLIT_NARROW_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_file_split(
+     const char *filename,
+     char delimiter,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_NARROW_FILE_H ) */
+
@@ -0,0 +1,705 @@
+/*
+ * Narrow character record reader functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_narrow_record_reader.h"
+#include "libcsplit_narrow_stream_splitter.h"
+#include "libcsplit_types.h"
+
+/* Creates a record reader
+ * Make sure the value record_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_record_reader_initialize(
+     libcsplit_narrow_record_reader_t **record_reader,
+     FILE *stream,
+     char delimiter,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_record_reader_t *internal_record_reader = NULL;
+	static char *function                                             = "libcsplit_narrow_record_reader_initialize";
+	int buffer_index                                                  = 0;
+
+	if( record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_reader = memory_allocate_structure(
+	                          libcsplit_internal_narrow_record_reader_t );
+
+	if( internal_record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_record_reader,
+	     0,
+	     sizeof( libcsplit_internal_narrow_record_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record reader.",
+		 function );
+
+		memory_free(
+		 internal_record_reader );
+
+		return( -1 );
+	}
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	if( pthread_mutex_init(
+	     &( internal_record_reader->mutex ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		memory_free(
+		 internal_record_reader );
+
+		return( -1 );
+	}
+	if( pthread_cond_init(
+	     &( internal_record_reader->condition ),
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		pthread_mutex_destroy(
+		 &( internal_record_reader->mutex ) );
+
+		memory_free(
+		 internal_record_reader );
+
+		return( -1 );
+	}
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+	internal_record_reader->stream     = stream;
+	internal_record_reader->block_size = block_size;
+
+	/* From here on libcsplit_narrow_record_reader_free can clean up
+	 */
+	*record_reader = (libcsplit_narrow_record_reader_t *) internal_record_reader;
+
+	for( buffer_index = 0;
+	     buffer_index < 2;
+	     buffer_index++ )
+	{
+		internal_record_reader->buffers[ buffer_index ].data = (char *) memory_allocate(
+		                                                                 sizeof( char ) * block_size );
+
+		if( internal_record_reader->buffers[ buffer_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	if( libcsplit_narrow_stream_splitter_initialize(
+	     &( internal_record_reader->stream_splitter ),
+	     delimiter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream splitter.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	if( pthread_create(
+	     &( internal_record_reader->read_ahead_thread ),
+	     NULL,
+	     &libcsplit_narrow_record_reader_read_ahead_thread_function,
+	     (void *) internal_record_reader ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead thread.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_reader->read_ahead_thread_started = 1;
+
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+	return( 1 );
+
+on_error:
+	libcsplit_narrow_record_reader_free(
+	 record_reader,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees a record reader
+ * If a read-ahead thread is active this function waits for the pending read to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_record_reader_free(
+     libcsplit_narrow_record_reader_t **record_reader,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_record_reader_t *internal_record_reader = NULL;
+	static char *function                                             = "libcsplit_narrow_record_reader_free";
+	int buffer_index                                                  = 0;
+	int result                                                        = 1;
+
+	if( record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_reader != NULL )
+	{
+		internal_record_reader = (libcsplit_internal_narrow_record_reader_t *) *record_reader;
+		*record_reader         = NULL;
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+		if( internal_record_reader->read_ahead_thread_started != 0 )
+		{
+			pthread_mutex_lock(
+			 &( internal_record_reader->mutex ) );
+
+			internal_record_reader->abort = 1;
+
+			pthread_cond_broadcast(
+			 &( internal_record_reader->condition ) );
+
+			pthread_mutex_unlock(
+			 &( internal_record_reader->mutex ) );
+
+			if( pthread_join(
+			     internal_record_reader->read_ahead_thread,
+			     NULL ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read-ahead thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		pthread_cond_destroy(
+		 &( internal_record_reader->condition ) );
+
+		pthread_mutex_destroy(
+		 &( internal_record_reader->mutex ) );
+
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+		if( internal_record_reader->stream_splitter != NULL )
+		{
+			if( libcsplit_narrow_stream_splitter_free(
+			     &( internal_record_reader->stream_splitter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stream splitter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( buffer_index = 0;
+		     buffer_index < 2;
+		     buffer_index++ )
+		{
+			if( internal_record_reader->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 internal_record_reader->buffers[ buffer_index ].data );
+			}
+		}
+		memory_free(
+		 internal_record_reader );
+	}
+	return( result );
+}
+
+/* Reads a block of the stream into a buffer
+ * This function sets the data size and end of stream values of the buffer
+ * but does not mark the buffer as filled
+ */
+void libcsplit_narrow_record_reader_read_buffer(
+      libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+      int buffer_index )
+{
+	libcsplit_narrow_record_reader_buffer_t *buffer = NULL;
+	size_t read_count                               = 0;
+
+	buffer = &( internal_record_reader->buffers[ buffer_index ] );
+
+	read_count = file_stream_read(
+	              internal_record_reader->stream,
+	              buffer->data,
+	              internal_record_reader->block_size );
+
+	buffer->data_size = read_count;
+
+	/* A short read indicates either the end of the stream or an error
+	 */
+	if( read_count < internal_record_reader->block_size )
+	{
+		if( file_stream_at_end(
+		     internal_record_reader->stream ) != 0 )
+		{
+			buffer->at_end = 1;
+		}
+		else
+		{
+			buffer->read_failed = 1;
+		}
+	}
+}
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+
+/* The read-ahead thread function
+ * Fills the buffers alternately while the splitter consumes the other buffer
+ * Returns NULL
+ */
+void *libcsplit_narrow_record_reader_read_ahead_thread_function(
+       void *arguments )
+{
+	libcsplit_internal_narrow_record_reader_t *internal_record_reader = NULL;
+	libcsplit_narrow_record_reader_buffer_t *buffer                   = NULL;
+	uint8_t stop_reading                                              = 0;
+
+	internal_record_reader = (libcsplit_internal_narrow_record_reader_t *) arguments;
+
+	while( stop_reading == 0 )
+	{
+		buffer = &( internal_record_reader->buffers[ internal_record_reader->read_buffer_index ] );
+
+		pthread_mutex_lock(
+		 &( internal_record_reader->mutex ) );
+
+		while( ( buffer->is_filled != 0 )
+		    && ( internal_record_reader->abort == 0 ) )
+		{
+			pthread_cond_wait(
+			 &( internal_record_reader->condition ),
+			 &( internal_record_reader->mutex ) );
+		}
+		stop_reading = internal_record_reader->abort;
+
+		pthread_mutex_unlock(
+		 &( internal_record_reader->mutex ) );
+
+		if( stop_reading != 0 )
+		{
+			break;
+		}
+		/* The buffer is not accessed by the splitter while it is not filled
+		 */
+		libcsplit_narrow_record_reader_read_buffer(
+		 internal_record_reader,
+		 internal_record_reader->read_buffer_index );
+
+		if( ( buffer->at_end != 0 )
+		 || ( buffer->read_failed != 0 ) )
+		{
+			stop_reading = 1;
+		}
+		pthread_mutex_lock(
+		 &( internal_record_reader->mutex ) );
+
+		buffer->is_filled = 1;
+
+		pthread_cond_broadcast(
+		 &( internal_record_reader->condition ) );
+
+		pthread_mutex_unlock(
+		 &( internal_record_reader->mutex ) );
+
+		internal_record_reader->read_buffer_index = 1 - internal_record_reader->read_buffer_index;
+	}
+	return( NULL );
+}
+
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+/* Waits until the buffer that is split next is filled
+ * Without a read-ahead thread the buffer is read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_record_reader_wait_for_buffer(
+     libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+     libcerror_error_t **error )
+{
+	libcsplit_narrow_record_reader_buffer_t *buffer = NULL;
+	static char *function                           = "libcsplit_narrow_record_reader_wait_for_buffer";
+
+	if( internal_record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record reader.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( internal_record_reader->buffers[ internal_record_reader->split_buffer_index ] );
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	pthread_mutex_lock(
+	 &( internal_record_reader->mutex ) );
+
+	while( buffer->is_filled == 0 )
+	{
+		pthread_cond_wait(
+		 &( internal_record_reader->condition ),
+		 &( internal_record_reader->mutex ) );
+	}
+	pthread_mutex_unlock(
+	 &( internal_record_reader->mutex ) );
+
+#else
+	if( buffer->is_filled == 0 )
+	{
+		libcsplit_narrow_record_reader_read_buffer(
+		 internal_record_reader,
+		 internal_record_reader->split_buffer_index );
+
+		buffer->is_filled = 1;
+	}
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+	if( buffer->read_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the buffer that was split, so that it can be refilled
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_record_reader_release_buffer(
+     libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+     libcerror_error_t **error )
+{
+	libcsplit_narrow_record_reader_buffer_t *buffer = NULL;
+	static char *function                           = "libcsplit_narrow_record_reader_release_buffer";
+
+	if( internal_record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record reader.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( internal_record_reader->buffers[ internal_record_reader->split_buffer_index ] );
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	pthread_mutex_lock(
+	 &( internal_record_reader->mutex ) );
+#endif
+	buffer->data_size   = 0;
+	buffer->at_end      = 0;
+	buffer->read_failed = 0;
+	buffer->is_filled   = 0;
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	pthread_cond_broadcast(
+	 &( internal_record_reader->condition ) );
+
+	pthread_mutex_unlock(
+	 &( internal_record_reader->mutex ) );
+#endif
+	internal_record_reader->split_buffer_index  = 1 - internal_record_reader->split_buffer_index;
+	internal_record_reader->split_buffer_in_use = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the next record
+ * The record is not terminated and the record size does not include an end-of-string character.
+ * The record references either the read buffer or the carry buffer of the splitter and
+ * remains valid until the next call to this function, after which the buffer can be refilled.
+ * The end-of-string character has no special meaning in the stream.
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libcsplit_narrow_record_reader_get_next_record(
+     libcsplit_narrow_record_reader_t *record_reader,
+     const char **record,
+     size_t *record_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_record_reader_t *internal_record_reader = NULL;
+	libcsplit_narrow_record_reader_buffer_t *buffer                   = NULL;
+	static char *function                                             = "libcsplit_narrow_record_reader_get_next_record";
+	uint8_t at_end                                                    = 0;
+	int result                                                        = 0;
+
+	if( record_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_reader = (libcsplit_internal_narrow_record_reader_t *) record_reader;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_record_reader->is_finished == 0 )
+	{
+		if( internal_record_reader->split_buffer_in_use == 0 )
+		{
+			if( libcsplit_narrow_record_reader_wait_for_buffer(
+			     internal_record_reader,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to retrieve buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer = &( internal_record_reader->buffers[ internal_record_reader->split_buffer_index ] );
+
+			if( libcsplit_narrow_stream_splitter_feed(
+			     internal_record_reader->stream_splitter,
+			     buffer->data,
+			     buffer->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to feed buffer to stream splitter.",
+				 function );
+
+				return( -1 );
+			}
+			internal_record_reader->split_buffer_in_use = 1;
+		}
+		result = libcsplit_narrow_stream_splitter_get_next_segment(
+		          internal_record_reader->stream_splitter,
+		          record,
+		          record_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next segment.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		/* The buffer was consumed, its remainder was copied into the carry buffer
+		 */
+		buffer = &( internal_record_reader->buffers[ internal_record_reader->split_buffer_index ] );
+		at_end = buffer->at_end;
+
+		if( libcsplit_narrow_record_reader_release_buffer(
+		     internal_record_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( at_end != 0 )
+		{
+			if( libcsplit_narrow_stream_splitter_finish(
+			     internal_record_reader->stream_splitter,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to finish stream splitter.",
+				 function );
+
+				return( -1 );
+			}
+			internal_record_reader->is_finished = 1;
+		}
+	}
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          internal_record_reader->stream_splitter,
+	          record,
+	          record_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,174 @@
+/*
+ * Narrow character record reader functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_NARROW_RECORD_READER_H )
+#define _LIBCSPLIT_NARROW_RECORD_READER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD	1
+#endif
+
+typedef struct libcsplit_narrow_record_reader_buffer libcsplit_narrow_record_reader_buffer_t;
+
+struct libcsplit_narrow_record_reader_buffer
+{
+	/* The data
+	 */
+	char *data;
+
+	/* The size of the data that was read
+	 */
+	size_t data_size;
+
+	/* Value to indicate the buffer contains data that was read
+	 */
+	uint8_t is_filled;
+
+	/* Value to indicate the end of the stream was reached
+	 */
+	uint8_t at_end;
+
+	/* Value to indicate reading the stream failed
+	 */
+	uint8_t read_failed;
+};
+
+typedef struct libcsplit_internal_narrow_record_reader libcsplit_internal_narrow_record_reader_t;
+
+struct libcsplit_internal_narrow_record_reader
+{
+	/* The stream
+	 */
+	FILE *stream;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The double buffer
+	 */
+	libcsplit_narrow_record_reader_buffer_t buffers[ 2 ];
+
+	/* The index of the buffer that is read next
+	 */
+	int read_buffer_index;
+
+	/* The index of the buffer that is split next or is being split
+	 */
+	int split_buffer_index;
+
+	/* Value to indicate the buffer is being split
+	 */
+	uint8_t split_buffer_in_use;
+
+	/* The stream splitter
+	 */
+	libcsplit_narrow_stream_splitter_t *stream_splitter;
+
+	/* Value to indicate the stream splitter was finished
+	 */
+	uint8_t is_finished;
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+	/* The read-ahead thread
+	 */
+	pthread_t read_ahead_thread;
+
+	/* Value to indicate the read-ahead thread was started
+	 */
+	uint8_t read_ahead_thread_started;
+
+	/* Value to indicate the read-ahead thread should stop
+	 */
+	uint8_t abort;
+
+	/* The mutex protecting the buffer states
+	 */
+	pthread_mutex_t mutex;
+
+	/* The condition signalled when a buffer state changes
+	 */
+	pthread_cond_t condition;
+
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+};
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_record_reader_initialize(
+     libcsplit_narrow_record_reader_t **record_reader,
+     FILE *stream,
+     char delimiter,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_record_reader_free(
+     libcsplit_narrow_record_reader_t **record_reader,
+     libcerror_error_t **error );
+
+void libcsplit_narrow_record_reader_read_buffer(
+      libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+      int buffer_index );
+
+#if defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD )
+
+void *libcsplit_narrow_record_reader_read_ahead_thread_function(
+       void *arguments );
+
+#endif /* defined( LIBCSPLIT_NARROW_RECORD_READER_HAVE_READ_AHEAD_THREAD ) */
+
+int libcsplit_narrow_record_reader_wait_for_buffer(
+     libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+     libcerror_error_t **error );
+
+int libcsplit_narrow_record_reader_release_buffer(
+     libcsplit_internal_narrow_record_reader_t *internal_record_reader,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_record_reader_get_next_record(
+     libcsplit_narrow_record_reader_t *record_reader,
+     const char **record,
+     size_t *record_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_NARROW_RECORD_READER_H ) */
+
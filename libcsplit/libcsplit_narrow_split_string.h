@@ -27,6 +27,8 @@
 
 #include "libcsplit_extern.h"
 #include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_serialization.h"
 #include "libcsplit_types.h"
 
 #if defined( __cplusplus )
@@ -56,6 +58,14 @@ struct libcsplit_internal_narrow_split_string
 	/* The segment sizes
 	 */
 	size_t *segment_sizes;
+
+	/* The mapped file, when the string references a memory mapped file
+	 */
+	libcsplit_mapped_file_t *mapped_file;
+
+	/* The flags
+	 */
+	uint8_t flags;
 };
 
 int libcsplit_narrow_split_string_initialize(
@@ -77,6 +87,12 @@ int libcsplit_narrow_split_string_get_string(
      size_t *string_size,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_get_flags(
+     libcsplit_narrow_split_string_t *split_string,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
 LIBCSPLIT_EXTERN \
 int libcsplit_narrow_split_string_get_number_of_segments(
      libcsplit_narrow_split_string_t *split_string,
@@ -99,6 +115,44 @@ int libcsplit_narrow_split_string_set_segment_by_index(
      size_t string_segment_size,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_get_joined_string_size(
+     libcsplit_narrow_split_string_t *split_string,
+     size_t *joined_string_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_join(
+     libcsplit_narrow_split_string_t *split_string,
+     char delimiter,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libcsplit_narrow_split_string_get_serialization_layout(
+     libcsplit_internal_narrow_split_string_t *internal_split_string,
+     libcsplit_serialization_layout_t *layout,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_get_serialized_size(
+     libcsplit_narrow_split_string_t *split_string,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_serialize(
+     libcsplit_narrow_split_string_t *split_string,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_split_string_deserialize_file(
+     const char *filename,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
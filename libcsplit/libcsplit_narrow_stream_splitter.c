@@ -0,0 +1,522 @@
+/*
+ * Narrow character stream splitter functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_narrow_stream_splitter.h"
+#include "libcsplit_types.h"
+
+/* Creates a stream splitter
+ * Make sure the value stream_splitter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_initialize(
+     libcsplit_narrow_stream_splitter_t **stream_splitter,
+     char delimiter,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter = NULL;
+	static char *function                                                 = "libcsplit_narrow_stream_splitter_initialize";
+
+	if( stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_splitter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream splitter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter = memory_allocate_structure(
+	                            libcsplit_internal_narrow_stream_splitter_t );
+
+	if( internal_stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream splitter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream_splitter,
+	     0,
+	     sizeof( libcsplit_internal_narrow_stream_splitter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream splitter.",
+		 function );
+
+		memory_free(
+		 internal_stream_splitter );
+
+		return( -1 );
+	}
+	internal_stream_splitter->carry_buffer = narrow_string_allocate(
+	                                          LIBCSPLIT_NARROW_STREAM_SPLITTER_CARRY_BUFFER_SIZE );
+
+	if( internal_stream_splitter->carry_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carry buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream_splitter->carry_buffer_size = LIBCSPLIT_NARROW_STREAM_SPLITTER_CARRY_BUFFER_SIZE;
+	internal_stream_splitter->delimiter         = delimiter;
+
+	*stream_splitter = (libcsplit_narrow_stream_splitter_t *) internal_stream_splitter;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream_splitter != NULL )
+	{
+		memory_free(
+		 internal_stream_splitter );
+	}
+	return( -1 );
+}
+
+/* Frees a stream splitter
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_free(
+     libcsplit_narrow_stream_splitter_t **stream_splitter,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter = NULL;
+	static char *function                                                 = "libcsplit_narrow_stream_splitter_free";
+
+	if( stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_splitter != NULL )
+	{
+		internal_stream_splitter = (libcsplit_internal_narrow_stream_splitter_t *) *stream_splitter;
+		*stream_splitter         = NULL;
+
+		if( internal_stream_splitter->carry_buffer != NULL )
+		{
+			memory_free(
+			 internal_stream_splitter->carry_buffer );
+		}
+		memory_free(
+		 internal_stream_splitter );
+	}
+	return( 1 );
+}
+
+/* Appends data to the carry buffer
+ * The carry buffer is resized when needed
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_append_to_carry_buffer(
+     libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char *reallocation       = NULL;
+	static char *function    = "libcsplit_narrow_stream_splitter_append_to_carry_buffer";
+	size_t carry_buffer_size = 0;
+
+	if( internal_stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_stream_splitter->carry_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	carry_buffer_size = internal_stream_splitter->carry_data_size + data_size;
+
+	if( carry_buffer_size > internal_stream_splitter->carry_buffer_size )
+	{
+		/* Grow the carry buffer exponentially to limit the number of reallocations
+		 */
+		if( carry_buffer_size < ( internal_stream_splitter->carry_buffer_size * 2 ) )
+		{
+			carry_buffer_size = internal_stream_splitter->carry_buffer_size * 2;
+		}
+		if( carry_buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			carry_buffer_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		reallocation = narrow_string_reallocate(
+		                internal_stream_splitter->carry_buffer,
+		                carry_buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize carry buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_stream_splitter->carry_buffer      = reallocation;
+		internal_stream_splitter->carry_buffer_size = carry_buffer_size;
+	}
+	if( memory_copy(
+	     &( internal_stream_splitter->carry_buffer[ internal_stream_splitter->carry_data_size ] ),
+	     data,
+	     sizeof( char ) * data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to carry buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter->carry_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Feeds a chunk of the input to the stream splitter
+ * The chunk is not copied and must remain valid until all its segments
+ * have been retrieved, which is when libcsplit_narrow_stream_splitter_get_next_segment
+ * returns 0. Only the start of a segment that straddles the end of the chunk
+ * is copied into the carry buffer.
+ * The end-of-string character has no special meaning in the input
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_feed(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     const char *chunk,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter = NULL;
+	static char *function                                                 = "libcsplit_narrow_stream_splitter_feed";
+
+	if( stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter = (libcsplit_internal_narrow_stream_splitter_t *) stream_splitter;
+
+	if( internal_stream_splitter->is_finished != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream splitter - already finished.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream_splitter->chunk_offset < internal_stream_splitter->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream splitter - previous chunk was not fully consumed.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter->chunk        = chunk;
+	internal_stream_splitter->chunk_size   = chunk_size;
+	internal_stream_splitter->chunk_offset = 0;
+
+	if( chunk_size > 0 )
+	{
+		internal_stream_splitter->has_pending_segment = 1;
+	}
+	return( 1 );
+}
+
+/* Signals the stream splitter that no more chunks will be fed
+ * The remaining data is returned as the last segment
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_finish(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter = NULL;
+	static char *function                                                 = "libcsplit_narrow_stream_splitter_finish";
+
+	if( stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter = (libcsplit_internal_narrow_stream_splitter_t *) stream_splitter;
+
+	internal_stream_splitter->is_finished = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next segment
+ * The string segment is not terminated by an end-of-string character and
+ * the string segment size does not include it. The string segment either
+ * references the current chunk or the carry buffer and remains valid until
+ * the next call to this function or libcsplit_narrow_stream_splitter_feed
+ * Returns 1 if successful, 0 if more input is needed or no more segments are available or -1 on error
+ */
+int libcsplit_narrow_stream_splitter_get_next_segment(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     const char **string_segment,
+     size_t *string_segment_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter = NULL;
+	const char *remaining_data                                            = NULL;
+	const char *segment_end                                               = NULL;
+	static char *function                                                 = "libcsplit_narrow_stream_splitter_get_next_segment";
+	size_t remaining_data_size                                            = 0;
+	size_t segment_length                                                 = 0;
+
+	if( stream_splitter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream splitter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_splitter = (libcsplit_internal_narrow_stream_splitter_t *) stream_splitter;
+
+	if( string_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string segment size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The segment returned by the previous call is no longer needed
+	 */
+	if( internal_stream_splitter->carry_buffer_returned != 0 )
+	{
+		internal_stream_splitter->carry_data_size       = 0;
+		internal_stream_splitter->carry_buffer_returned = 0;
+	}
+	if( internal_stream_splitter->chunk_offset < internal_stream_splitter->chunk_size )
+	{
+		remaining_data      = &( internal_stream_splitter->chunk[ internal_stream_splitter->chunk_offset ] );
+		remaining_data_size = internal_stream_splitter->chunk_size - internal_stream_splitter->chunk_offset;
+
+		segment_end = narrow_string_search_character(
+		               remaining_data,
+		               internal_stream_splitter->delimiter,
+		               remaining_data_size );
+
+		if( segment_end != NULL )
+		{
+			segment_length = (size_t) ( segment_end - remaining_data );
+
+			internal_stream_splitter->chunk_offset += segment_length + 1;
+
+			if( internal_stream_splitter->carry_data_size == 0 )
+			{
+				*string_segment      = remaining_data;
+				*string_segment_size = segment_length;
+
+				return( 1 );
+			}
+			if( libcsplit_narrow_stream_splitter_append_to_carry_buffer(
+			     internal_stream_splitter,
+			     remaining_data,
+			     segment_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment data to carry buffer.",
+				 function );
+
+				return( -1 );
+			}
+			*string_segment      = internal_stream_splitter->carry_buffer;
+			*string_segment_size = internal_stream_splitter->carry_data_size;
+
+			internal_stream_splitter->carry_buffer_returned = 1;
+
+			return( 1 );
+		}
+		/* The segment straddles the end of the chunk
+		 */
+		if( libcsplit_narrow_stream_splitter_append_to_carry_buffer(
+		     internal_stream_splitter,
+		     remaining_data,
+		     remaining_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append remaining chunk data to carry buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_stream_splitter->chunk_offset = internal_stream_splitter->chunk_size;
+	}
+	internal_stream_splitter->chunk        = NULL;
+	internal_stream_splitter->chunk_size   = 0;
+	internal_stream_splitter->chunk_offset = 0;
+
+	if( ( internal_stream_splitter->is_finished == 0 )
+	 || ( internal_stream_splitter->has_pending_segment == 0 ) )
+	{
+		return( 0 );
+	}
+	*string_segment      = internal_stream_splitter->carry_buffer;
+	*string_segment_size = internal_stream_splitter->carry_data_size;
+
+	internal_stream_splitter->carry_buffer_returned = 1;
+	internal_stream_splitter->has_pending_segment   = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,127 @@
+/*
+ * Narrow character stream splitter functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_NARROW_STREAM_SPLITTER_H )
+#define _LIBCSPLIT_NARROW_STREAM_SPLITTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial size of the carry buffer
+ */
+#define LIBCSPLIT_NARROW_STREAM_SPLITTER_CARRY_BUFFER_SIZE	256
+
+typedef struct libcsplit_internal_narrow_stream_splitter libcsplit_internal_narrow_stream_splitter_t;
+
+struct libcsplit_internal_narrow_stream_splitter
+{
+	/* The delimiter
+	 */
+	char delimiter;
+
+	/* The current chunk
+	 */
+	const char *chunk;
+
+	/* The current chunk size
+	 */
+	size_t chunk_size;
+
+	/* The offset in the current chunk
+	 */
+	size_t chunk_offset;
+
+	/* The carry buffer, which contains the start of a segment
+	 * that straddles a chunk boundary
+	 */
+	char *carry_buffer;
+
+	/* The carry buffer size
+	 */
+	size_t carry_buffer_size;
+
+	/* The size of the data in the carry buffer
+	 */
+	size_t carry_data_size;
+
+	/* Value to indicate the carry buffer was returned as a segment
+	 */
+	uint8_t carry_buffer_returned;
+
+	/* Value to indicate a segment is pending
+	 */
+	uint8_t has_pending_segment;
+
+	/* Value to indicate no more chunks will be fed
+	 */
+	uint8_t is_finished;
+};
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_stream_splitter_initialize(
+     libcsplit_narrow_stream_splitter_t **stream_splitter,
+     char delimiter,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_stream_splitter_free(
+     libcsplit_narrow_stream_splitter_t **stream_splitter,
+     libcerror_error_t **error );
+
+int libcsplit_narrow_stream_splitter_append_to_carry_buffer(
+     libcsplit_internal_narrow_stream_splitter_t *internal_stream_splitter,
+     const char *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_stream_splitter_feed(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     const char *chunk,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_stream_splitter_finish(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_stream_splitter_get_next_segment(
+     libcsplit_narrow_stream_splitter_t *stream_splitter,
+     const char **string_segment,
+     size_t *string_segment_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_NARROW_STREAM_SPLITTER_H ) */
+
@@ -20,32 +20,71 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libcsplit_definitions.h"
+#include "libcsplit_field_decoder.h"
+#include "libcsplit_key_value_table.h"
 #include "libcsplit_libcerror.h"
 #include "libcsplit_narrow_split_string.h"
 #include "libcsplit_narrow_string.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_split_hierarchy.h"
 #include "libcsplit_types.h"
 
-/* Splits a narrow character string
+/* The string functions are generated from the template
+ */
+#define LIBCSPLIT_TEMPLATE_CHARACTER_T				char
+#define LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit )		(uint32_t) (uint8_t) ( code_unit )
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_T			libcsplit_narrow_split_string_t
+#define LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T		libcsplit_internal_narrow_split_string_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )	libcsplit_narrow_split_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION( name )		libcsplit_narrow_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( name )		"libcsplit_narrow_string_" name
+
+/* Single code units are searched for with memchr, strchr is not bounded by size
+ */
+#if defined( HAVE_MEMCHR ) || defined( WINAPI )
+#define LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) \
+	narrow_string_search_character( string, code_unit, size )
+#endif
+
+#include "libcsplit_string_template.h"
+
+/* Splits a narrow character string on delimiters that are not escaped
+ * An escape character escapes the character that follows it, hence an escaped
+ * delimiter is part of the segment. The escaped characters are determined from
+ * the escape character positions with bitmask arithmetic on blocks of 64
+ * characters, without inspecting every character
+ * If LIBCSPLIT_ESCAPE_FLAG_UNESCAPE is set the escape characters are removed
+ * from the segments, an escape character at the end of the string is kept
+ * The string ends at the first end-of-string character or the last character
  * Make sure the value split_string is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libcsplit_narrow_string_split(
+int libcsplit_narrow_string_split_escaped(
      const char *string,
      size_t string_size,
      char delimiter,
+     char escape,
+     uint8_t flags,
      libcsplit_narrow_split_string_t **split_string,
      libcerror_error_t **error )
 {
-	char *segment_start    = NULL;
-	char *segment_end      = NULL;
-	char *string_end       = NULL;
-	char *string_start     = NULL;
-	static char *function  = "libcsplit_narrow_string_split";
-	ssize_t segment_length = 0;
-	int number_of_segments = 0;
-	int segment_index      = 0;
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	char *string_copy                                               = NULL;
+	static char *function                                           = "libcsplit_narrow_string_split_escaped";
+	size_t copy_index                                               = 0;
+	size_t segment_end                                              = 0;
+	size_t segment_start                                            = 0;
+	size_t string_index                                             = 0;
+	size_t string_length                                            = 0;
+	uint8_t escape_state                                            = 0;
+	uint8_t supported_flags                                         = 0;
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
 
 	if( string == NULL )
 	{
@@ -69,6 +108,33 @@ int libcsplit_narrow_string_split(
 
 		return( -1 );
 	}
+	if( ( delimiter == 0 )
+	 || ( escape == 0 )
+	 || ( delimiter == escape ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported delimiter and escape.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBCSPLIT_ESCAPE_FLAG_UNESCAPE;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	if( split_string == NULL )
 	{
 		libcerror_error_set(
@@ -98,53 +164,45 @@ int libcsplit_narrow_string_split(
 	{
 		return( 1 );
 	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
 	/* Determine the number of segments
 	 */
-	segment_start = (char *) string;
-	string_end    = (char *) &( string[ string_size - 1 ] );
+	number_of_segments = 1;
 
-	do
+	while( string_index < string_length )
 	{
-		segment_end = segment_start;
-
-		while( segment_end <= string_end )
-		{
-			if( ( segment_end == string_end )
-			 || ( *segment_end == 0 ) )
-			{
-				segment_end = NULL;
-
-				break;
-			}
-			else if( *segment_end == delimiter )
-			{
-				break;
-			}
-			segment_end++;
-		}
-		if( segment_end > string_end )
-		{
-			break;
-		}
-		segment_index++;
+		string_index += libcsplit_simd_search_unescaped(
+		                 (uint8_t *) &( string[ string_index ] ),
+		                 (uint8_t) delimiter,
+		                 (uint8_t) escape,
+		                 string_length - string_index,
+		                 &escape_state );
 
-		if( segment_end == NULL )
+		if( string_index >= string_length )
 		{
 			break;
 		}
-		if( segment_end == segment_start )
-		{
-			segment_start++;
-		}
-		else if( segment_end != string )
+		if( number_of_segments == INT_MAX )
 		{
-			segment_start = segment_end + 1;
-		}
-	}
-	while( segment_end != NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
 
-	number_of_segments = segment_index;
+			return( -1 );
+		}
+		number_of_segments++;
 
+		string_index++;
+	}
 	if( libcsplit_narrow_split_string_initialize(
 	     split_string,
 	     string,
@@ -161,122 +219,324 @@ int libcsplit_narrow_string_split(
 
 		goto on_error;
 	}
-	/* Do not bother with strings that do not need splitting
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	/* Determine the segments
+	 * the segments are terminated and optionally unescaped in the copy of the
+	 * string, which never grows since every segment end-of-string character
+	 * replaces a delimiter
 	 */
-	if( number_of_segments == 0 )
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
 	{
-		return( 1 );
+		escape_state = 0;
+
+		segment_end = string_index + libcsplit_simd_search_unescaped(
+		                              (uint8_t *) &( string_copy[ string_index ] ),
+		                              (uint8_t) delimiter,
+		                              (uint8_t) escape,
+		                              string_length - string_index,
+		                              &escape_state );
+
+		segment_start = copy_index;
+
+		if( ( flags & LIBCSPLIT_ESCAPE_FLAG_UNESCAPE ) == 0 )
+		{
+			/* Without unescaping the segments remain at their original offsets
+			 */
+			string_index = segment_end;
+			copy_index   = segment_end;
+		}
+		else
+		{
+			while( string_index < segment_end )
+			{
+				if( ( string_copy[ string_index ] == escape )
+				 && ( ( string_index + 1 ) < segment_end ) )
+				{
+					string_index++;
+				}
+				string_copy[ copy_index++ ] = string_copy[ string_index++ ];
+			}
+		}
+		string_copy[ copy_index++ ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ segment_start ] );
+		internal_split_string->segment_sizes[ segment_index ] = copy_index - segment_start;
+
+		string_index++;
 	}
-	/* Determine the segments
-	 * empty segments are stored as strings only containing the end of character
-	 */
-	if( libcsplit_narrow_split_string_get_string(
-	     *split_string,
-	     &string_start,
-	     &string_size,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a narrow character string into the fields with specific indexes
+ * The field indexes must be in ascending order without duplicates. The split
+ * string contains a segment per field index in the same order, the other
+ * fields are not stored. The string is scanned up to the end of the field with
+ * the last field index and only that part of the string is copied
+ * A field index beyond the last field of the string results in an empty segment,
+ * this includes every field index of an empty string
+ * The string ends at the first end-of-string character or the last character
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_string_split_fields(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     const int *field_indexes,
+     int number_of_field_indexes,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	size_t *segment_offsets                                         = NULL;
+	static char *function                                           = "libcsplit_narrow_string_split_fields";
+	size_t copy_size                                                = 1;
+	size_t segment_end                                              = 0;
+	size_t segment_start                                            = 0;
+	size_t string_length                                            = 0;
+	int field_index                                                 = 0;
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
+
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve split string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( string_start == NULL )
+	if( string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing string start.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( string_size < 1 )
+	if( field_indexes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field indexes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( number_of_field_indexes <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of field indexes value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
 	}
-	segment_start = string_start;
-	string_end    = &( string_start[ string_size - 1 ] );
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
 
+		return( -1 );
+	}
 	for( segment_index = 0;
-	     segment_index < number_of_segments;
+	     segment_index < number_of_field_indexes;
 	     segment_index++ )
 	{
-		segment_end = segment_start;
-
-		while( segment_end <= string_end )
+		if( ( field_indexes[ segment_index ] < 0 )
+		 || ( ( segment_index > 0 )
+		  &&  ( field_indexes[ segment_index ] <= field_indexes[ segment_index - 1 ] ) ) )
 		{
-			if( ( segment_end == string_end )
-			 || ( *segment_end == 0 ) )
-			{
-				segment_end = NULL;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field index: %d.",
+			 function,
+			 segment_index );
 
-				break;
-			}
-			else if( *segment_end == delimiter )
-			{
-				break;
-			}
-			segment_end++;
-		}
-		if( segment_end == NULL )
-		{
-			segment_length = (ssize_t) ( string_end - segment_start );
-		}
-		else
-		{
-			segment_length = (ssize_t) ( segment_end - segment_start );
+			return( -1 );
 		}
-		if( segment_length >= 0 )
+	}
+	/* The string ends at the first end of string character or the last character
+	 * an empty string consists of a single empty field
+	 */
+	if( string_size > 0 )
+	{
+		string_length = libcsplit_narrow_string_search_code_unit(
+		                 string,
+		                 string_size - 1,
+		                 0 );
+	}
+	if( libcsplit_narrow_split_string_initialize(
+	     split_string,
+	     NULL,
+	     0,
+	     number_of_field_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	segment_offsets = (size_t *) memory_allocate(
+	                              sizeof( size_t ) * number_of_field_indexes );
+
+	if( segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the offsets and sizes of the fields with the field indexes
+	 * the scan stops at the end of the field with the last field index
+	 */
+	segment_index = 0;
+
+	while( segment_index < number_of_field_indexes )
+	{
+		segment_end = segment_start + libcsplit_narrow_string_search_code_unit(
+		                               &( string[ segment_start ] ),
+		                               string_length - segment_start,
+		                               delimiter );
+
+		if( field_index == field_indexes[ segment_index ] )
 		{
-			segment_start[ segment_length ] = 0;
+			segment_offsets[ segment_index ]                      = segment_start;
+			internal_split_string->segment_sizes[ segment_index ] = ( segment_end - segment_start ) + 1;
 
-			if( libcsplit_narrow_split_string_set_segment_by_index(
-			     *split_string,
-			     segment_index,
-			     segment_start,
-			     segment_length + 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set split string segment: %d.",
-				 function,
-				 segment_index );
+			copy_size = segment_end + 1;
 
-				goto on_error;
-			}
+			segment_index++;
 		}
-		if( segment_end == NULL )
+		if( segment_end >= string_length )
 		{
 			break;
 		}
-		if( segment_end == string_start )
-		{
-			segment_start++;
-		}
-		else
-		{
-			segment_start = segment_end + 1;
-		}
+		segment_start = segment_end + 1;
+
+		field_index++;
+	}
+	number_of_segments = segment_index;
+
+	/* Only the part of the string up to the end of the last field is copied
+	 */
+	internal_split_string->string = (char *) memory_allocate(
+	                                          sizeof( char ) * copy_size );
+
+	if( internal_split_string->string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_split_string->string,
+	     string,
+	     sizeof( char ) * ( copy_size - 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string->string[ copy_size - 1 ] = 0;
+	internal_split_string->string_size             = copy_size;
+
+	/* The fields are terminated in the copy of the string
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_start = segment_offsets[ segment_index ];
+		segment_end   = segment_start + internal_split_string->segment_sizes[ segment_index ] - 1;
+
+		internal_split_string->string[ segment_end ] = 0;
+
+		internal_split_string->segments[ segment_index ] = &( internal_split_string->string[ segment_start ] );
+	}
+	/* The fields beyond the last field of the string are empty
+	 */
+	while( segment_index < number_of_field_indexes )
+	{
+		internal_split_string->segments[ segment_index ]      = &( internal_split_string->string[ copy_size - 1 ] );
+		internal_split_string->segment_sizes[ segment_index ] = 1;
+
+		segment_index++;
 	}
+	memory_free(
+	 segment_offsets );
+
 	return( 1 );
 
 on_error:
+	if( segment_offsets != NULL )
+	{
+		memory_free(
+		 segment_offsets );
+	}
 	if( *split_string != NULL )
 	{
 		libcsplit_narrow_split_string_free(
@@ -286,3 +546,1135 @@ on_error:
 	return( -1 );
 }
 
+/* Splits a narrow character string into a hierarchy of segments
+ * The delimiters are ordered from the outermost to the innermost level, such
+ * as record, field and subfield delimiters. A delimiter ends the segment of its
+ * level and the segments of all deeper levels, hence every segment has at least
+ * one child segment in the next level
+ * The string is scanned once and every delimiter is classified with a single
+ * lookup of the nibble classes of the byte, that is vectorized, where every
+ * level is assigned a bit of the byte class
+ * The segment offsets and sizes are in characters relative to the start of
+ * the string and exclude the delimiter
+ * The string ends at the first end-of-string character or the last character
+ * Make sure the value split_hierarchy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_string_split_hierarchy(
+     const char *string,
+     size_t string_size,
+     const char *delimiters,
+     int number_of_delimiters,
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     libcerror_error_t **error )
+{
+	size_t segment_starts[ LIBCSPLIT_SPLIT_HIERARCHY_MAXIMUM_NUMBER_OF_LEVELS ];
+	uint8_t high_nibble_classes[ 16 ];
+	uint8_t low_nibble_classes[ 16 ];
+
+	static char *function  = "libcsplit_narrow_string_split_hierarchy";
+	size_t string_index    = 0;
+	size_t string_length   = 0;
+	uint8_t byte_class     = 0;
+	uint8_t delimiter_byte = 0;
+	int delimiter_index    = 0;
+	int delimiter_level    = 0;
+	int level              = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( delimiters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid delimiters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_delimiters <= 0 )
+	 || ( number_of_delimiters > LIBCSPLIT_SPLIT_HIERARCHY_MAXIMUM_NUMBER_OF_LEVELS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of delimiters value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_hierarchy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split hierarchy already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     low_nibble_classes,
+	     0,
+	     sizeof( uint8_t ) * 16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear low nibble classes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     high_nibble_classes,
+	     0,
+	     sizeof( uint8_t ) * 16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear high nibble classes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every level is assigned a bit in the classes of the nibbles of its
+	 * delimiter, hence the class of a byte is the bit of its level or 0
+	 */
+	for( delimiter_index = 0;
+	     delimiter_index < number_of_delimiters;
+	     delimiter_index++ )
+	{
+		delimiter_byte = (uint8_t) delimiters[ delimiter_index ];
+
+		if( ( delimiter_byte == 0 )
+		 || ( LIBCSPLIT_SIMD_GET_BYTE_CLASS(
+		       low_nibble_classes,
+		       high_nibble_classes,
+		       delimiter_byte ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported delimiter: %d.",
+			 function,
+			 delimiter_index );
+
+			return( -1 );
+		}
+		low_nibble_classes[ delimiter_byte & 0x0f ] |= (uint8_t) ( 1 << delimiter_index );
+		high_nibble_classes[ delimiter_byte >> 4 ]  |= (uint8_t) ( 1 << delimiter_index );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	if( libcsplit_split_hierarchy_initialize(
+	     split_hierarchy,
+	     number_of_delimiters,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split hierarchy.",
+		 function );
+
+		goto on_error;
+	}
+	for( level = 0;
+	     level < number_of_delimiters;
+	     level++ )
+	{
+		segment_starts[ level ] = 0;
+	}
+	while( string_index <= string_length )
+	{
+		string_index += libcsplit_simd_search_byte_class(
+		                 (uint8_t *) &( string[ string_index ] ),
+		                 low_nibble_classes,
+		                 high_nibble_classes,
+		                 string_length - string_index );
+
+		/* The end of the string ends the segments of every level
+		 */
+		if( string_index >= string_length )
+		{
+			delimiter_level = 0;
+		}
+		else
+		{
+			byte_class = LIBCSPLIT_SIMD_GET_BYTE_CLASS(
+			              low_nibble_classes,
+			              high_nibble_classes,
+			              (uint8_t) string[ string_index ] );
+
+			for( delimiter_level = 0;
+			     ( byte_class & 0x01 ) == 0;
+			     delimiter_level++ )
+			{
+				byte_class >>= 1;
+			}
+		}
+		/* The segments are appended from the deepest level up, hence the
+		 * child segments of a segment are appended before the segment
+		 */
+		for( level = number_of_delimiters - 1;
+		     level >= delimiter_level;
+		     level-- )
+		{
+			if( libcsplit_split_hierarchy_append_segment(
+			     *split_hierarchy,
+			     level,
+			     segment_starts[ level ],
+			     string_index - segment_starts[ level ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment: %d.",
+				 function,
+				 level );
+
+				goto on_error;
+			}
+			segment_starts[ level ] = string_index + 1;
+		}
+		string_index++;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_hierarchy != NULL )
+	{
+		libcsplit_split_hierarchy_free(
+		 split_hierarchy,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a narrow character string into key value pairs
+ * The pairs are separated by the pair delimiter and the key is separated from
+ * the value by the first key value delimiter in the pair. A pair without key
+ * value delimiter has an empty value and empty pairs are skipped
+ * The pairs are determined in a single pass over a copy of the string, that
+ * is owned by the key value table, by terminating the keys and values in place
+ * If LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX is set a hash index of the keys is
+ * built, that is used by libcsplit_key_value_table_get_value_by_key
+ * The string ends at the first end-of-string character or the last character
+ * A string without pairs has no key value table
+ * Make sure the value key_value_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_string_split_key_values(
+     const char *string,
+     size_t string_size,
+     char pair_delimiter,
+     char key_value_delimiter,
+     uint8_t flags,
+     libcsplit_key_value_table_t **key_value_table,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_key_value_table_t *internal_key_value_table = NULL;
+	char *string_copy                                              = NULL;
+	static char *function                                          = "libcsplit_narrow_string_split_key_values";
+	size_t key_length                                              = 0;
+	size_t pair_end                                                = 0;
+	size_t pair_start                                              = 0;
+	size_t string_length                                           = 0;
+	uint8_t supported_flags                                        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pair_delimiter == 0 )
+	 || ( key_value_delimiter == 0 )
+	 || ( pair_delimiter == key_value_delimiter ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pair and key value delimiter.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( key_value_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_value_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key value table already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no pairs
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	if( libcsplit_key_value_table_initialize(
+	     key_value_table,
+	     string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize key value table.",
+		 function );
+
+		goto on_error;
+	}
+	internal_key_value_table = (libcsplit_internal_key_value_table_t *) *key_value_table;
+
+	/* Determine the pairs
+	 * the pair delimiter terminates the value and the first key value
+	 * delimiter in the pair terminates the key in the copy of the string
+	 */
+	string_copy = internal_key_value_table->string;
+
+	while( pair_start < string_length )
+	{
+		pair_end = pair_start + libcsplit_narrow_string_search_code_unit(
+		                         &( string_copy[ pair_start ] ),
+		                         string_length - pair_start,
+		                         pair_delimiter );
+
+		if( pair_end > pair_start )
+		{
+			key_length = libcsplit_narrow_string_search_code_unit(
+			              &( string_copy[ pair_start ] ),
+			              pair_end - pair_start,
+			              key_value_delimiter );
+
+			string_copy[ pair_end ] = 0;
+
+			/* A pair without key value delimiter has an empty value, that is
+			 * the end-of-string character of the key
+			 */
+			if( ( pair_start + key_length ) < pair_end )
+			{
+				string_copy[ pair_start + key_length ] = 0;
+
+				if( libcsplit_key_value_table_append_pair(
+				     *key_value_table,
+				     &( string_copy[ pair_start ] ),
+				     key_length + 1,
+				     &( string_copy[ pair_start + key_length + 1 ] ),
+				     pair_end - ( pair_start + key_length ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append pair.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( libcsplit_key_value_table_append_pair(
+			          *key_value_table,
+			          &( string_copy[ pair_start ] ),
+			          key_length + 1,
+			          &( string_copy[ pair_end ] ),
+			          1,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append pair.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		pair_start = pair_end + 1;
+	}
+	if( internal_key_value_table->number_of_pairs == 0 )
+	{
+		libcsplit_key_value_table_free(
+		 key_value_table,
+		 NULL );
+
+		return( 1 );
+	}
+	if( ( flags & LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX ) != 0 )
+	{
+		if( libcsplit_key_value_table_build_hash_index(
+		     *key_value_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build hash index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *key_value_table != NULL )
+	{
+		libcsplit_key_value_table_free(
+		 key_value_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a narrow character string on delimiters that are not enclosed in quotes
+ * The quoting follows RFC 4180, a quote inside a quoted field is escaped by
+ * doubling it. The quotes are removed from the segments and the escaped quotes
+ * are replaced by a single quote. A quote inside an unquoted field also starts
+ * a quoted section. A string with a missing closing quote is not supported and
+ * results in an error
+ * The string ends at the first end-of-string character or the last character
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_string_split_quoted(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     char quote,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	char *string_copy                                               = NULL;
+	static char *function                                           = "libcsplit_narrow_string_split_quoted";
+	size_t copy_index                                               = 0;
+	size_t segment_end                                              = 0;
+	size_t segment_start                                            = 0;
+	size_t string_index                                             = 0;
+	size_t string_length                                            = 0;
+	uint8_t quote_state                                             = 0;
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( delimiter == 0 )
+	 || ( quote == 0 )
+	 || ( delimiter == quote ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported delimiter and quote.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	/* Determine the number of segments
+	 * the quoted sections are determined with a vectorized prefix XOR over the
+	 * quote positions, hence the delimiter search does not fall back to
+	 * inspecting every character inside quoted fields
+	 */
+	number_of_segments = 1;
+
+	while( string_index < string_length )
+	{
+		string_index += libcsplit_simd_search_unquoted(
+		                 (uint8_t *) &( string[ string_index ] ),
+		                 (uint8_t) delimiter,
+		                 (uint8_t) quote,
+		                 string_length - string_index,
+		                 &quote_state );
+
+		if( string_index >= string_length )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		string_index++;
+	}
+	if( quote_state != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string - missing closing quote.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_narrow_split_string_initialize(
+	     split_string,
+	     string,
+	     string_size,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	/* Determine the segments
+	 * the quotes are removed in the copy of the string, which never grows since
+	 * every segment end-of-string character replaces a delimiter
+	 */
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_end = string_index + libcsplit_simd_search_unquoted(
+		                              (uint8_t *) &( string_copy[ string_index ] ),
+		                              (uint8_t) delimiter,
+		                              (uint8_t) quote,
+		                              string_length - string_index,
+		                              &quote_state );
+
+		segment_start = copy_index;
+
+		while( string_index < segment_end )
+		{
+			if( string_copy[ string_index ] != quote )
+			{
+				string_copy[ copy_index++ ] = string_copy[ string_index ];
+			}
+			else if( ( quote_state != 0 )
+			      && ( ( string_index + 1 ) < segment_end )
+			      && ( string_copy[ string_index + 1 ] == quote ) )
+			{
+				string_copy[ copy_index++ ] = quote;
+
+				string_index++;
+			}
+			else
+			{
+				quote_state ^= 1;
+			}
+			string_index++;
+		}
+		string_copy[ copy_index++ ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ segment_start ] );
+		internal_split_string->segment_sizes[ segment_index ] = copy_index - segment_start;
+
+		string_index++;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a narrow character string into the fields with specific indexes and decodes their values
+ * The field indexes must be in ascending order without duplicates. The value of the field
+ * with field_indexes[ n ] is decoded according to field_types[ n ] and stored at offset
+ * value_offsets[ n ] in the record data. Every value is 8 bytes of size and stored in host
+ * byte order as an int64_t for the LIBCSPLIT_FIELD_TYPE_INT64 and timestamp field types,
+ * as an uint64_t for the LIBCSPLIT_FIELD_TYPE_UINT64 and LIBCSPLIT_FIELD_TYPE_HEXADECIMAL
+ * field types and as a double for the LIBCSPLIT_FIELD_TYPE_DOUBLE field type
+ * Timestamps are stored as the number of nanoseconds since January 1, 1970 00:00:00 UTC
+ * A field is decoded as soon as its end is found, without a copy of the string, and the
+ * string is scanned up to the end of the field with the last field index
+ * The string ends at the first end-of-string character or the last character
+ * Returns 1 if successful, 0 if the string does not contain a field with one of the
+ * field indexes or -1 on error
+ */
+int libcsplit_narrow_string_split_typed_fields(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     const int *field_indexes,
+     const uint8_t *field_types,
+     const size_t *value_offsets,
+     int number_of_field_indexes,
+     uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_narrow_string_split_typed_fields";
+	size_t segment_end    = 0;
+	size_t segment_start  = 0;
+	size_t string_length  = 0;
+	int field_index       = 0;
+	int segment_index     = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field types.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_field_indexes <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of field indexes value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < LIBCSPLIT_FIELD_DECODER_VALUE_SIZE )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate the schema before the scan so that a decode error is the only
+	 * reason to stop in the middle of the string
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_field_indexes;
+	     segment_index++ )
+	{
+		if( ( field_indexes[ segment_index ] < 0 )
+		 || ( ( segment_index > 0 )
+		  &&  ( field_indexes[ segment_index ] <= field_indexes[ segment_index - 1 ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field index: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( ( field_types[ segment_index ] < LIBCSPLIT_FIELD_TYPE_INT64 )
+		 || ( field_types[ segment_index ] > LIBCSPLIT_FIELD_TYPE_TIMESTAMP_ISO8601 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field type: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( value_offsets[ segment_index ] > ( record_data_size - LIBCSPLIT_FIELD_DECODER_VALUE_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value offset: %d value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	/* An empty string has no fields
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 0 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	segment_index = 0;
+
+	while( segment_index < number_of_field_indexes )
+	{
+		segment_end = segment_start + libcsplit_narrow_string_search_code_unit(
+		                               &( string[ segment_start ] ),
+		                               string_length - segment_start,
+		                               delimiter );
+
+		if( field_index == field_indexes[ segment_index ] )
+		{
+			if( libcsplit_field_decoder_decode_value(
+			     &( string[ segment_start ] ),
+			     segment_end - segment_start,
+			     field_types[ segment_index ],
+			     &( record_data[ value_offsets[ segment_index ] ] ),
+			     record_data_size - value_offsets[ segment_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to decode value of field: %d.",
+				 function,
+				 field_index );
+
+				return( -1 );
+			}
+			segment_index++;
+		}
+		if( segment_end >= string_length )
+		{
+			break;
+		}
+		segment_start = segment_end + 1;
+
+		field_index++;
+	}
+	if( segment_index < number_of_field_indexes )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Splits a narrow character string on runs of whitespace characters
+ * A run of whitespace characters separates two segments, whitespace characters
+ * at the start and end of the string do not produce empty segments. The
+ * whitespace characters are space, horizontal tab, line feed, vertical tab,
+ * form feed and carriage return
+ * The segment boundaries are determined from the transitions in the mask of
+ * whitespace characters, which is determined 64 characters at a time
+ * The string ends at the first end-of-string character or the last character
+ * A string that only contains whitespace characters has no segments
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_narrow_string_split_whitespace(
+     const char *string,
+     size_t string_size,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	char *string_copy                                               = NULL;
+	static char *function                                           = "libcsplit_narrow_string_split_whitespace";
+	size_t segment_start                                            = 0;
+	size_t string_index                                             = 0;
+	size_t string_length                                            = 0;
+	uint8_t whitespace_state                                        = 0;
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = libcsplit_narrow_string_search_code_unit(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	/* Determine the number of segments, every transition from whitespace
+	 * to another character starts a segment
+	 */
+	whitespace_state = 1;
+
+	while( string_index < string_length )
+	{
+		string_index += libcsplit_simd_search_whitespace_transition(
+		                 (uint8_t *) &( string[ string_index ] ),
+		                 string_length - string_index,
+		                 &whitespace_state );
+
+		if( string_index >= string_length )
+		{
+			break;
+		}
+		if( whitespace_state == 0 )
+		{
+			if( number_of_segments == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of segments value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_segments++;
+		}
+		string_index++;
+	}
+	if( number_of_segments == 0 )
+	{
+		return( 1 );
+	}
+	if( libcsplit_narrow_split_string_initialize(
+	     split_string,
+	     string,
+	     string_size,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	/* Determine the segments
+	 * the segments are terminated in the copy of the string at the first
+	 * whitespace character that follows them
+	 */
+	string_copy      = internal_split_string->string;
+	string_index     = 0;
+	whitespace_state = 1;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		string_index += libcsplit_simd_search_whitespace_transition(
+		                 (uint8_t *) &( string_copy[ string_index ] ),
+		                 string_length - string_index,
+		                 &whitespace_state );
+
+		segment_start = string_index;
+
+		string_index += libcsplit_simd_search_whitespace_transition(
+		                 (uint8_t *) &( string_copy[ string_index ] ),
+		                 string_length - string_index,
+		                 &whitespace_state );
+
+		string_copy[ string_index ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ segment_start ] );
+		internal_split_string->segment_sizes[ segment_index ] = ( string_index - segment_start ) + 1;
+
+		string_index++;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
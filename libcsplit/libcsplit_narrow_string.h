@@ -41,6 +41,120 @@ int libcsplit_narrow_string_split(
      libcsplit_narrow_split_string_t **split_string,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_binary(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_escaped(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     char escape,
+     uint8_t flags,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_fields(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     const int *field_indexes,
+     int number_of_field_indexes,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_hierarchy(
+     const char *string,
+     size_t string_size,
+     const char *delimiters,
+     int number_of_delimiters,
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_key_values(
+     const char *string,
+     size_t string_size,
+     char pair_delimiter,
+     char key_value_delimiter,
+     uint8_t flags,
+     libcsplit_key_value_table_t **key_value_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_multi_string(
+     const char *string,
+     size_t string_size,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_path(
+     const char *path,
+     size_t path_size,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_quoted(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     char quote,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_typed_fields(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     const int *field_indexes,
+     const uint8_t *field_types,
+     const size_t *value_offsets,
+     int number_of_field_indexes,
+     uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_whitespace(
+     const char *string,
+     size_t string_size,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_split_with_options(
+     const char *string,
+     size_t string_size,
+     char delimiter,
+     uint8_t flags,
+     const char *trim_characters,
+     size_t number_of_trim_characters,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_narrow_string_transcode_delimiters(
+     const char *string,
+     size_t string_size,
+     const char *delimiters,
+     size_t number_of_delimiters,
+     char replacement_delimiter,
+     uint8_t flags,
+     char *transcoded_string,
+     size_t transcoded_string_size,
+     size_t *transcoded_string_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1447 @@
+/*
+ * Segment index functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "csplit_segment_index.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_segment_index.h"
+#include "libcsplit_segment_index_range.h"
+#include "libcsplit_types.h"
+#include "libcsplit_varint.h"
+
+const uint8_t libcsplit_segment_index_file_signature[ 8 ] = {
+	'C', 'S', 'P', 'L', 'T', 'I', 'D', 'X' };
+
+/* Appends a checkpoint to the build state
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_build_state_append_checkpoint(
+     libcsplit_segment_index_build_state_t *build_state,
+     uint64_t segment_offset,
+     uint64_t stream_offset,
+     libcerror_error_t **error )
+{
+	csplit_segment_index_checkpoint_t *checkpoint = NULL;
+	uint8_t *reallocation                         = NULL;
+	static char *function                         = "libcsplit_segment_index_build_state_append_checkpoint";
+	size_t allocated_size                         = 0;
+
+	if( build_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid build state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( build_state->checkpoints_allocated_size - build_state->checkpoints_data_size ) < sizeof( csplit_segment_index_checkpoint_t ) )
+	{
+		if( build_state->checkpoints_allocated_size == 0 )
+		{
+			allocated_size = 256 * sizeof( csplit_segment_index_checkpoint_t );
+		}
+		else if( build_state->checkpoints_allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid checkpoints allocated size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			allocated_size = build_state->checkpoints_allocated_size * 2;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            build_state->checkpoints_data,
+		                            sizeof( uint8_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize checkpoints data.",
+			 function );
+
+			return( -1 );
+		}
+		build_state->checkpoints_data           = reallocation;
+		build_state->checkpoints_allocated_size = allocated_size;
+	}
+	checkpoint = (csplit_segment_index_checkpoint_t *) &( build_state->checkpoints_data[ build_state->checkpoints_data_size ] );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 checkpoint->segment_offset,
+	 segment_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 checkpoint->stream_offset,
+	 stream_offset );
+
+	build_state->checkpoints_data_size += sizeof( csplit_segment_index_checkpoint_t );
+	build_state->number_of_checkpoints += 1;
+
+	return( 1 );
+}
+
+/* Writes the segment offsets of a scanned range to the index file
+ * The first segment of the range is encoded relative to the last segment of the previous ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_build_state_write_range(
+     libcsplit_segment_index_build_state_t *build_state,
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error )
+{
+	uint8_t varint_data[ LIBCSPLIT_VARINT_MAXIMUM_SIZE ];
+
+	static char *function = "libcsplit_segment_index_build_state_write_range";
+	size_t encoded_size   = 0;
+	size_t stream_offset  = 0;
+	size_t write_count    = 0;
+	uint64_t value_64bit  = 0;
+
+	if( build_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid build state.",
+		 function );
+
+		return( -1 );
+	}
+	if( build_state->checkpoint_interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid build state - checkpoint interval value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( range->number_of_segments == 0 )
+	{
+		return( 1 );
+	}
+	if( libcsplit_varint_encode(
+	     range->first_segment_offset - build_state->segment_offset,
+	     varint_data,
+	     LIBCSPLIT_VARINT_MAXIMUM_SIZE,
+	     &encoded_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to encode segment offset difference.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               build_state->file_stream,
+	               varint_data,
+	               encoded_size );
+
+	if( write_count != encoded_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write segment offset difference.",
+		 function );
+
+		return( -1 );
+	}
+	build_state->stream_offset  += encoded_size;
+	build_state->segment_offset  = range->first_segment_offset;
+	build_state->segment_index  += 1;
+
+	if( ( build_state->segment_index % build_state->checkpoint_interval ) == 0 )
+	{
+		if( libcsplit_segment_index_build_state_append_checkpoint(
+		     build_state,
+		     build_state->segment_offset,
+		     build_state->stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Determine the checkpoints of the remaining segments of the range
+	 */
+	while( stream_offset < range->stream_size )
+	{
+		if( libcsplit_varint_decode(
+		     &( range->stream[ stream_offset ] ),
+		     range->stream_size - stream_offset,
+		     &value_64bit,
+		     &encoded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode segment offset difference.",
+			 function );
+
+			return( -1 );
+		}
+		stream_offset += encoded_size;
+
+		build_state->segment_offset += value_64bit;
+		build_state->segment_index  += 1;
+
+		if( ( build_state->segment_index % build_state->checkpoint_interval ) == 0 )
+		{
+			if( libcsplit_segment_index_build_state_append_checkpoint(
+			     build_state,
+			     build_state->segment_offset,
+			     build_state->stream_offset + stream_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append checkpoint.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( range->stream_size > 0 )
+	{
+		write_count = file_stream_write(
+		               build_state->file_stream,
+		               range->stream,
+		               range->stream_size );
+
+		if( write_count != range->stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write segment offset stream.",
+			 function );
+
+			return( -1 );
+		}
+		build_state->stream_offset += range->stream_size;
+	}
+	return( 1 );
+}
+
+/* Builds a segment index file of a narrow character file
+ * The file is scanned once, in ranges that are scanned concurrently if supported.
+ * The offset of every segment is stored as the difference to the offset of the
+ * previous segment, encoded as a variable-length integer. The offset of every
+ * checkpoint interval-th segment is stored as a checkpoint.
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_build(
+     const char *filename,
+     char delimiter,
+     uint32_t checkpoint_interval,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	csplit_segment_index_file_header_t file_header;
+
+	libcsplit_segment_index_build_state_t build_state;
+
+	libcsplit_segment_index_range_t *ranges[ LIBCSPLIT_SEGMENT_INDEX_NUMBER_OF_RANGES ] = {
+		NULL, NULL, NULL, NULL };
+
+	libcsplit_mapped_file_t *mapped_file = NULL;
+	static char *function                = "libcsplit_segment_index_build";
+	size_t data_offset                   = 0;
+	size_t range_data_size               = 0;
+	size_t range_size                    = 0;
+	size_t write_count                   = 0;
+	uint64_t number_of_segments          = 0;
+	int number_of_ranges                 = 0;
+	int number_of_scanned_ranges         = 0;
+	int range_index                      = 0;
+
+#if defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD )
+	int number_of_started_threads        = 0;
+	int result                           = 1;
+#endif
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid checkpoint interval value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &build_state,
+	     0,
+	     sizeof( libcsplit_segment_index_build_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear build state.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( csplit_segment_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	build_state.checkpoint_interval = checkpoint_interval;
+
+	if( libcsplit_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcsplit_mapped_file_open(
+	     mapped_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	build_state.file_stream = file_stream_open(
+	                           index_filename,
+	                           FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( build_state.file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	/* The file header is written again when the index is complete
+	 */
+	write_count = file_stream_write(
+	               build_state.file_stream,
+	               &file_header,
+	               sizeof( csplit_segment_index_file_header_t ) );
+
+	if( write_count != sizeof( csplit_segment_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( mapped_file->data_size > 0 )
+	{
+		/* The first segment starts at the start of the data
+		 */
+		if( libcsplit_segment_index_build_state_append_checkpoint(
+		     &build_state,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append first checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		range_size = LIBCSPLIT_SEGMENT_INDEX_RANGE_SIZE;
+
+		if( range_size > mapped_file->data_size )
+		{
+			range_size = mapped_file->data_size;
+		}
+		number_of_ranges = LIBCSPLIT_SEGMENT_INDEX_NUMBER_OF_RANGES;
+
+		if( ( ( mapped_file->data_size - 1 ) / range_size ) < (size_t) number_of_ranges )
+		{
+			number_of_ranges = (int) ( ( mapped_file->data_size - 1 ) / range_size ) + 1;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcsplit_segment_index_range_initialize(
+			     &( ranges[ range_index ] ),
+			     range_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		while( data_offset < mapped_file->data_size )
+		{
+			for( number_of_scanned_ranges = 0;
+			     number_of_scanned_ranges < number_of_ranges;
+			     number_of_scanned_ranges++ )
+			{
+				if( data_offset >= mapped_file->data_size )
+				{
+					break;
+				}
+				range_data_size = mapped_file->data_size - data_offset;
+
+				if( range_data_size > range_size )
+				{
+					range_data_size = range_size;
+				}
+				if( libcsplit_segment_index_range_set_data(
+				     ranges[ number_of_scanned_ranges ],
+				     &( mapped_file->data[ data_offset ] ),
+				     range_data_size,
+				     (uint64_t) data_offset,
+				     (uint8_t) delimiter,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set data of range: %d.",
+					 function,
+					 number_of_scanned_ranges );
+
+					goto on_error;
+				}
+				data_offset += range_data_size;
+			}
+#if defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD )
+			if( number_of_scanned_ranges > 1 )
+			{
+				for( number_of_started_threads = 0;
+				     number_of_started_threads < number_of_scanned_ranges;
+				     number_of_started_threads++ )
+				{
+					if( libcsplit_segment_index_range_start_scan_thread(
+					     ranges[ number_of_started_threads ],
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to start scan thread of range: %d.",
+						 function,
+						 number_of_started_threads );
+
+						result = -1;
+
+						break;
+					}
+				}
+				/* Wait for all the started threads, also if starting a thread failed
+				 */
+				for( range_index = 0;
+				     range_index < number_of_started_threads;
+				     range_index++ )
+				{
+					if( libcsplit_segment_index_range_join_scan_thread(
+					     ranges[ range_index ],
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to scan range: %d.",
+						 function,
+						 range_index );
+
+						result = -1;
+					}
+				}
+				if( result != 1 )
+				{
+					goto on_error;
+				}
+			}
+			else
+#endif /* defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD ) */
+			{
+				for( range_index = 0;
+				     range_index < number_of_scanned_ranges;
+				     range_index++ )
+				{
+					if( libcsplit_segment_index_range_scan(
+					     ranges[ range_index ],
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to scan range: %d.",
+						 function,
+						 range_index );
+
+						goto on_error;
+					}
+				}
+			}
+			for( range_index = 0;
+			     range_index < number_of_scanned_ranges;
+			     range_index++ )
+			{
+				if( libcsplit_segment_index_build_state_write_range(
+				     &build_state,
+				     ranges[ range_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write range: %d.",
+					 function,
+					 range_index );
+
+					goto on_error;
+				}
+			}
+		}
+		number_of_segments = build_state.segment_index + 1;
+	}
+	if( build_state.checkpoints_data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               build_state.file_stream,
+		               build_state.checkpoints_data,
+		               build_state.checkpoints_data_size );
+
+		if( write_count != build_state.checkpoints_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoints.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     libcsplit_segment_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBCSPLIT_SEGMENT_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.checkpoint_interval,
+	 checkpoint_interval );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.data_size,
+	 (uint64_t) mapped_file->data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.number_of_segments,
+	 number_of_segments );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.stream_size,
+	 build_state.stream_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 file_header.number_of_checkpoints,
+	 build_state.number_of_checkpoints );
+
+	file_header.delimiter = (uint8_t) delimiter;
+
+	if( file_stream_seek_offset(
+	     build_state.file_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               build_state.file_stream,
+	               &file_header,
+	               sizeof( csplit_segment_index_file_header_t ) );
+
+	if( write_count != sizeof( csplit_segment_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     build_state.file_stream ) != 0 )
+	{
+		build_state.file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	build_state.file_stream = NULL;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( libcsplit_segment_index_range_free(
+		     &( ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	if( build_state.checkpoints_data != NULL )
+	{
+		memory_free(
+		 build_state.checkpoints_data );
+
+		build_state.checkpoints_data = NULL;
+	}
+	if( libcsplit_mapped_file_free(
+	     &mapped_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( build_state.file_stream != NULL )
+	{
+		file_stream_close(
+		 build_state.file_stream );
+	}
+	for( range_index = 0;
+	     range_index < LIBCSPLIT_SEGMENT_INDEX_NUMBER_OF_RANGES;
+	     range_index++ )
+	{
+		if( ranges[ range_index ] != NULL )
+		{
+			libcsplit_segment_index_range_free(
+			 &( ranges[ range_index ] ),
+			 NULL );
+		}
+	}
+	if( build_state.checkpoints_data != NULL )
+	{
+		memory_free(
+		 build_state.checkpoints_data );
+	}
+	if( mapped_file != NULL )
+	{
+		libcsplit_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a segment index
+ * Make sure the value segment_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_initialize(
+     libcsplit_segment_index_t **segment_index,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_initialize";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index = memory_allocate_structure(
+	                          libcsplit_internal_segment_index_t );
+
+	if( internal_segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_segment_index,
+	     0,
+	     sizeof( libcsplit_internal_segment_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment index.",
+		 function );
+
+		goto on_error;
+	}
+	*segment_index = (libcsplit_segment_index_t *) internal_segment_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_segment_index != NULL )
+	{
+		memory_free(
+		 internal_segment_index );
+	}
+	return( -1 );
+}
+
+/* Frees a segment index
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_free(
+     libcsplit_segment_index_t **segment_index,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_free";
+	int result                                                 = 1;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index != NULL )
+	{
+		internal_segment_index = (libcsplit_internal_segment_index_t *) *segment_index;
+		*segment_index         = NULL;
+
+		if( internal_segment_index->mapped_file != NULL )
+		{
+			if( libcsplit_mapped_file_free(
+			     &( internal_segment_index->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_segment_index );
+	}
+	return( result );
+}
+
+/* Opens a segment index file
+ * The index file is mapped read-only into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_open(
+     libcsplit_segment_index_t *segment_index,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	csplit_segment_index_file_header_t *file_header            = NULL;
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_open";
+	size_t remaining_data_size                                 = 0;
+	uint64_t expected_number_of_checkpoints                    = 0;
+	uint64_t number_of_checkpoints                             = 0;
+	uint64_t number_of_segments                                = 0;
+	uint64_t stream_size                                       = 0;
+	uint32_t checkpoint_interval                               = 0;
+	uint32_t format_version                                    = 0;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index = (libcsplit_internal_segment_index_t *) segment_index;
+
+	if( internal_segment_index->mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment index - mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_mapped_file_initialize(
+	     &( internal_segment_index->mapped_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcsplit_mapped_file_open(
+	     internal_segment_index->mapped_file,
+	     index_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map index file: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( internal_segment_index->mapped_file->data_size < sizeof( csplit_segment_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid index file - data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	file_header = (csplit_segment_index_file_header_t *) internal_segment_index->mapped_file->data;
+
+	if( memory_compare(
+	     file_header->signature,
+	     libcsplit_segment_index_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid index file signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->checkpoint_interval,
+	 checkpoint_interval );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->data_size,
+	 internal_segment_index->data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->number_of_segments,
+	 number_of_segments );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->stream_size,
+	 stream_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 file_header->number_of_checkpoints,
+	 number_of_checkpoints );
+
+	if( format_version != LIBCSPLIT_SEGMENT_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( checkpoint_interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid checkpoint interval value zero or less.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_segments > 0 )
+	{
+		expected_number_of_checkpoints = ( ( number_of_segments - 1 ) / checkpoint_interval ) + 1;
+	}
+	if( number_of_checkpoints != expected_number_of_checkpoints )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in number of checkpoints.",
+		 function );
+
+		goto on_error;
+	}
+	remaining_data_size = internal_segment_index->mapped_file->data_size - sizeof( csplit_segment_index_file_header_t );
+
+	if( stream_size > (uint64_t) remaining_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	remaining_data_size -= (size_t) stream_size;
+
+	if( ( number_of_checkpoints > (uint64_t) ( remaining_data_size / sizeof( csplit_segment_index_checkpoint_t ) ) )
+	 || ( ( number_of_checkpoints * sizeof( csplit_segment_index_checkpoint_t ) ) != (uint64_t) remaining_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid number of checkpoints value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_segment_index->checkpoint_interval   = checkpoint_interval;
+	internal_segment_index->number_of_segments    = number_of_segments;
+	internal_segment_index->stream                = &( internal_segment_index->mapped_file->data[ sizeof( csplit_segment_index_file_header_t ) ] );
+	internal_segment_index->stream_size           = (size_t) stream_size;
+	internal_segment_index->checkpoints_data      = &( internal_segment_index->stream[ stream_size ] );
+	internal_segment_index->number_of_checkpoints = number_of_checkpoints;
+
+	return( 1 );
+
+on_error:
+	if( internal_segment_index->mapped_file != NULL )
+	{
+		libcsplit_mapped_file_free(
+		 &( internal_segment_index->mapped_file ),
+		 NULL );
+	}
+	internal_segment_index->data_size = 0;
+
+	return( -1 );
+}
+
+/* Closes a segment index file
+ * Returns 0 if successful or -1 on error
+ */
+int libcsplit_segment_index_close(
+     libcsplit_segment_index_t *segment_index,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_close";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index = (libcsplit_internal_segment_index_t *) segment_index;
+
+	if( internal_segment_index->mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment index - missing mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_mapped_file_free(
+	     &( internal_segment_index->mapped_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index->checkpoint_interval   = 0;
+	internal_segment_index->data_size             = 0;
+	internal_segment_index->number_of_segments    = 0;
+	internal_segment_index->stream                = NULL;
+	internal_segment_index->stream_size           = 0;
+	internal_segment_index->checkpoints_data      = NULL;
+	internal_segment_index->number_of_checkpoints = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the number of segments
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_get_number_of_segments(
+     libcsplit_segment_index_t *segment_index,
+     uint64_t *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_get_number_of_segments";
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index = (libcsplit_internal_segment_index_t *) segment_index;
+
+	if( internal_segment_index->mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment index - missing mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = internal_segment_index->number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves the offset and size of a specific segment in the indexed data
+ * The segment is located by decoding at most checkpoint interval segment offsets
+ * from the nearest preceding checkpoint. The segment size does not include the delimiter.
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_get_segment_by_index(
+     libcsplit_segment_index_t *segment_index,
+     uint64_t segment_number,
+     uint64_t *segment_offset,
+     uint64_t *segment_size,
+     libcerror_error_t **error )
+{
+	csplit_segment_index_checkpoint_t *checkpoint              = NULL;
+	libcsplit_internal_segment_index_t *internal_segment_index = NULL;
+	static char *function                                      = "libcsplit_segment_index_get_segment_by_index";
+	size_t decoded_size                                        = 0;
+	uint64_t checkpoint_index                                  = 0;
+	uint64_t difference_index                                  = 0;
+	uint64_t number_of_differences                             = 0;
+	uint64_t safe_segment_offset                               = 0;
+	uint64_t stream_offset                                     = 0;
+	uint64_t value_64bit                                       = 0;
+
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_index = (libcsplit_internal_segment_index_t *) segment_index;
+
+	if( internal_segment_index->mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment index - missing mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_number >= internal_segment_index->number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_index      = segment_number / internal_segment_index->checkpoint_interval;
+	number_of_differences = segment_number % internal_segment_index->checkpoint_interval;
+
+	checkpoint = (csplit_segment_index_checkpoint_t *) &( internal_segment_index->checkpoints_data[ checkpoint_index * sizeof( csplit_segment_index_checkpoint_t ) ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 checkpoint->segment_offset,
+	 safe_segment_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 checkpoint->stream_offset,
+	 stream_offset );
+
+	if( stream_offset > (uint64_t) internal_segment_index->stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid checkpoint: %" PRIu64 " stream offset value out of bounds.",
+		 function,
+		 checkpoint_index );
+
+		return( -1 );
+	}
+	/* Decode the offset differences up to the segment and the difference to the next segment
+	 */
+	if( ( segment_number + 1 ) < internal_segment_index->number_of_segments )
+	{
+		number_of_differences += 1;
+	}
+	for( difference_index = 0;
+	     difference_index < number_of_differences;
+	     difference_index++ )
+	{
+		if( libcsplit_varint_decode(
+		     &( internal_segment_index->stream[ stream_offset ] ),
+		     internal_segment_index->stream_size - (size_t) stream_offset,
+		     &value_64bit,
+		     &decoded_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode segment offset difference.",
+			 function );
+
+			return( -1 );
+		}
+		stream_offset += decoded_size;
+
+		if( ( value_64bit == 0 )
+		 || ( safe_segment_offset > internal_segment_index->data_size )
+		 || ( value_64bit > ( internal_segment_index->data_size - safe_segment_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid segment offset difference value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The difference to the next segment is only used to determine the segment size
+		 */
+		if( ( ( difference_index + 1 ) < number_of_differences )
+		 || ( ( segment_number + 1 ) == internal_segment_index->number_of_segments ) )
+		{
+			safe_segment_offset += value_64bit;
+		}
+	}
+	if( safe_segment_offset > internal_segment_index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_offset = safe_segment_offset;
+
+	if( ( segment_number + 1 ) < internal_segment_index->number_of_segments )
+	{
+		/* The last decoded difference includes the delimiter
+		 */
+		*segment_size = value_64bit - 1;
+	}
+	else
+	{
+		*segment_size = internal_segment_index->data_size - safe_segment_offset;
+	}
+	return( 1 );
+}
+
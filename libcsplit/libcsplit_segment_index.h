@@ -0,0 +1,190 @@
+/*
+ * Segment index functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_SEGMENT_INDEX_H )
+#define _LIBCSPLIT_SEGMENT_INDEX_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_segment_index_range.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The format version of the segment index file
+ */
+#define LIBCSPLIT_SEGMENT_INDEX_FORMAT_VERSION		1
+
+/* The maximum size of the data scanned by a single range
+ */
+#define LIBCSPLIT_SEGMENT_INDEX_RANGE_SIZE		( 16 * 1024 * 1024 )
+
+/* The number of ranges that are scanned concurrently
+ */
+#define LIBCSPLIT_SEGMENT_INDEX_NUMBER_OF_RANGES	4
+
+extern const uint8_t libcsplit_segment_index_file_signature[ 8 ];
+
+typedef struct libcsplit_segment_index_build_state libcsplit_segment_index_build_state_t;
+
+struct libcsplit_segment_index_build_state
+{
+	/* The index file stream
+	 */
+	FILE *file_stream;
+
+	/* The checkpoint interval
+	 */
+	uint32_t checkpoint_interval;
+
+	/* The offset of the last segment that was added
+	 */
+	uint64_t segment_offset;
+
+	/* The index of the last segment that was added
+	 */
+	uint64_t segment_index;
+
+	/* The size of the segment offset stream written so far
+	 */
+	uint64_t stream_offset;
+
+	/* The encoded checkpoints
+	 */
+	uint8_t *checkpoints_data;
+
+	/* The size of the encoded checkpoints
+	 */
+	size_t checkpoints_data_size;
+
+	/* The allocated size of the encoded checkpoints
+	 */
+	size_t checkpoints_allocated_size;
+
+	/* The number of checkpoints
+	 */
+	uint64_t number_of_checkpoints;
+};
+
+typedef struct libcsplit_internal_segment_index libcsplit_internal_segment_index_t;
+
+struct libcsplit_internal_segment_index
+{
+	/* The mapped index file
+	 */
+	libcsplit_mapped_file_t *mapped_file;
+
+	/* The checkpoint interval
+	 */
+	uint32_t checkpoint_interval;
+
+	/* The size of the indexed data
+	 */
+	uint64_t data_size;
+
+	/* The number of segments
+	 */
+	uint64_t number_of_segments;
+
+	/* The segment offset stream
+	 */
+	const uint8_t *stream;
+
+	/* The segment offset stream size
+	 */
+	size_t stream_size;
+
+	/* The encoded checkpoints
+	 */
+	const uint8_t *checkpoints_data;
+
+	/* The number of checkpoints
+	 */
+	uint64_t number_of_checkpoints;
+};
+
+int libcsplit_segment_index_build_state_append_checkpoint(
+     libcsplit_segment_index_build_state_t *build_state,
+     uint64_t segment_offset,
+     uint64_t stream_offset,
+     libcerror_error_t **error );
+
+int libcsplit_segment_index_build_state_write_range(
+     libcsplit_segment_index_build_state_t *build_state,
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_build(
+     const char *filename,
+     char delimiter,
+     uint32_t checkpoint_interval,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_initialize(
+     libcsplit_segment_index_t **segment_index,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_free(
+     libcsplit_segment_index_t **segment_index,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_open(
+     libcsplit_segment_index_t *segment_index,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_close(
+     libcsplit_segment_index_t *segment_index,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_get_number_of_segments(
+     libcsplit_segment_index_t *segment_index,
+     uint64_t *number_of_segments,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_index_get_segment_by_index(
+     libcsplit_segment_index_t *segment_index,
+     uint64_t segment_number,
+     uint64_t *segment_offset,
+     uint64_t *segment_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_SEGMENT_INDEX_H ) */
+
@@ -0,0 +1,426 @@
+/*
+ * Segment index range functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_segment_index_range.h"
+#include "libcsplit_varint.h"
+
+/* Creates a range
+ * Make sure the value range is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_initialize(
+     libcsplit_segment_index_range_t **range,
+     size_t maximum_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_segment_index_range_initialize";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( *range != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid range value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_data_size == 0 )
+	 || ( maximum_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*range = memory_allocate_structure(
+	          libcsplit_segment_index_range_t );
+
+	if( *range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *range,
+	     0,
+	     sizeof( libcsplit_segment_index_range_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear range.",
+		 function );
+
+		memory_free(
+		 *range );
+
+		*range = NULL;
+
+		return( -1 );
+	}
+	/* Every encoded difference is at least 1 and takes at most as many bytes
+	 * as its value, hence the stream is never larger than the data of the range
+	 */
+	( *range )->stream = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * maximum_data_size );
+
+	if( ( *range )->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *range )->maximum_data_size = maximum_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *range != NULL )
+	{
+		memory_free(
+		 *range );
+
+		*range = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a range
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_free(
+     libcsplit_segment_index_range_t **range,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_segment_index_range_free";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( *range != NULL )
+	{
+		if( ( *range )->stream != NULL )
+		{
+			memory_free(
+			 ( *range )->stream );
+		}
+		memory_free(
+		 *range );
+
+		*range = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the data of a range
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_set_data(
+     libcsplit_segment_index_range_t *range,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     uint8_t delimiter,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_segment_index_range_set_data";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > range->maximum_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	range->data                 = data;
+	range->data_size            = data_size;
+	range->data_offset          = data_offset;
+	range->delimiter            = delimiter;
+	range->stream_size          = 0;
+	range->number_of_segments   = 0;
+	range->first_segment_offset = 0;
+	range->last_segment_offset  = 0;
+	range->scan_result          = 0;
+
+	return( 1 );
+}
+
+/* Scans the data of a range for segments
+ * A segment starts after every delimiter in the range
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_scan(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error )
+{
+	const uint8_t *data_end     = NULL;
+	const uint8_t *delimiter    = NULL;
+	const uint8_t *search_start = NULL;
+	static char *function       = "libcsplit_segment_index_range_scan";
+	size_t encoded_size         = 0;
+	uint64_t segment_offset     = 0;
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( range->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid range - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	search_start = range->data;
+	data_end     = &( range->data[ range->data_size ] );
+
+	while( search_start < data_end )
+	{
+		delimiter = (const uint8_t *) narrow_string_search_character(
+		                               (const char *) search_start,
+		                               (char) range->delimiter,
+		                               (size_t) ( data_end - search_start ) );
+
+		if( delimiter == NULL )
+		{
+			break;
+		}
+		segment_offset = range->data_offset + (uint64_t) ( delimiter - range->data ) + 1;
+
+		if( range->number_of_segments == 0 )
+		{
+			range->first_segment_offset = segment_offset;
+		}
+		else
+		{
+			if( libcsplit_varint_encode(
+			     segment_offset - range->last_segment_offset,
+			     &( range->stream[ range->stream_size ] ),
+			     range->maximum_data_size - range->stream_size,
+			     &encoded_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to encode segment offset difference.",
+				 function );
+
+				return( -1 );
+			}
+			range->stream_size += encoded_size;
+		}
+		range->last_segment_offset = segment_offset;
+
+		range->number_of_segments++;
+
+		search_start = delimiter + 1;
+	}
+	return( 1 );
+}
+
+#if defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD )
+
+/* The scan thread function
+ * Returns NULL
+ */
+void *libcsplit_segment_index_range_scan_thread_function(
+       void *arguments )
+{
+	libcsplit_segment_index_range_t *range = NULL;
+
+	range = (libcsplit_segment_index_range_t *) arguments;
+
+	range->scan_result = libcsplit_segment_index_range_scan(
+	                      range,
+	                      NULL );
+
+	return( NULL );
+}
+
+/* Starts scanning the range on a separate thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_start_scan_thread(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_segment_index_range_start_scan_thread";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( pthread_create(
+	     &( range->scan_thread ),
+	     NULL,
+	     &libcsplit_segment_index_range_scan_thread_function,
+	     (void *) range ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits for the scan thread of the range to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_index_range_join_scan_thread(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_segment_index_range_join_scan_thread";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( pthread_join(
+	     range->scan_thread,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join scan thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( range->scan_result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD ) */
+
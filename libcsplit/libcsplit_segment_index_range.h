@@ -0,0 +1,140 @@
+/*
+ * Segment index range functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_SEGMENT_INDEX_RANGE_H )
+#define _LIBCSPLIT_SEGMENT_INDEX_RANGE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcsplit_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD	1
+#endif
+
+typedef struct libcsplit_segment_index_range libcsplit_segment_index_range_t;
+
+struct libcsplit_segment_index_range
+{
+	/* The data of the range
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the range in the indexed data
+	 */
+	uint64_t data_offset;
+
+	/* The delimiter
+	 */
+	uint8_t delimiter;
+
+	/* The stream, which contains the encoded differences between
+	 * the offsets of consecutive segments that start in the range
+	 */
+	uint8_t *stream;
+
+	/* The stream size
+	 */
+	size_t stream_size;
+
+	/* The maximum data size, which is also the size of the stream buffer
+	 */
+	size_t maximum_data_size;
+
+	/* The number of segments that start in the range
+	 */
+	uint64_t number_of_segments;
+
+	/* The offset of the first segment that starts in the range
+	 */
+	uint64_t first_segment_offset;
+
+	/* The offset of the last segment that starts in the range
+	 */
+	uint64_t last_segment_offset;
+
+	/* The result of the scan
+	 */
+	int scan_result;
+
+#if defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD )
+	/* The scan thread
+	 */
+	pthread_t scan_thread;
+
+#endif /* defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD ) */
+};
+
+int libcsplit_segment_index_range_initialize(
+     libcsplit_segment_index_range_t **range,
+     size_t maximum_data_size,
+     libcerror_error_t **error );
+
+int libcsplit_segment_index_range_free(
+     libcsplit_segment_index_range_t **range,
+     libcerror_error_t **error );
+
+int libcsplit_segment_index_range_set_data(
+     libcsplit_segment_index_range_t *range,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     uint8_t delimiter,
+     libcerror_error_t **error );
+
+int libcsplit_segment_index_range_scan(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error );
+
+#if defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD )
+
+void *libcsplit_segment_index_range_scan_thread_function(
+       void *arguments );
+
+int libcsplit_segment_index_range_start_scan_thread(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error );
+
+int libcsplit_segment_index_range_join_scan_thread(
+     libcsplit_segment_index_range_t *range,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCSPLIT_SEGMENT_INDEX_RANGE_HAVE_SCAN_THREAD ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_SEGMENT_INDEX_RANGE_H ) */
+
@@ -0,0 +1,394 @@
+/*
+ * Segment table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_segment_table.h"
+#include "libcsplit_types.h"
+
+/* Creates a segment table
+ * Make sure the value segment_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_table_initialize(
+     libcsplit_segment_table_t **segment_table,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_table_t *internal_segment_table = NULL;
+	static char *function                                      = "libcsplit_segment_table_initialize";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segments less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_table = memory_allocate_structure(
+	                          libcsplit_internal_segment_table_t );
+
+	if( internal_segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_segment_table,
+	     0,
+	     sizeof( libcsplit_internal_segment_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment table.",
+		 function );
+
+		memory_free(
+		 internal_segment_table );
+
+		return( -1 );
+	}
+	if( number_of_segments > 0 )
+	{
+		internal_segment_table->segment_offsets = (size_t *) memory_allocate(
+		                                                      sizeof( size_t ) * number_of_segments );
+
+		if( internal_segment_table->segment_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment offsets.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_segment_table->segment_offsets,
+		     0,
+		     sizeof( size_t ) * number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment offsets.",
+			 function );
+
+			goto on_error;
+		}
+		internal_segment_table->segment_sizes = (size_t *) memory_allocate(
+		                                                    sizeof( size_t ) * number_of_segments );
+
+		if( internal_segment_table->segment_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment sizes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_segment_table->segment_sizes,
+		     0,
+		     sizeof( size_t ) * number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_segment_table->number_of_segments = number_of_segments;
+
+	*segment_table = (libcsplit_segment_table_t *) internal_segment_table;
+
+	return( 1 );
+
+on_error:
+	if( internal_segment_table != NULL )
+	{
+		if( internal_segment_table->segment_sizes != NULL )
+		{
+			memory_free(
+			 internal_segment_table->segment_sizes );
+		}
+		if( internal_segment_table->segment_offsets != NULL )
+		{
+			memory_free(
+			 internal_segment_table->segment_offsets );
+		}
+		memory_free(
+		 internal_segment_table );
+	}
+	return( -1 );
+}
+
+/* Frees a segment table
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_table_free(
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_table_t *internal_segment_table = NULL;
+	static char *function                                      = "libcsplit_segment_table_free";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+		internal_segment_table = (libcsplit_internal_segment_table_t *) *segment_table;
+		*segment_table         = NULL;
+
+		if( internal_segment_table->segment_offsets != NULL )
+		{
+			memory_free(
+			 internal_segment_table->segment_offsets );
+		}
+		if( internal_segment_table->segment_sizes != NULL )
+		{
+			memory_free(
+			 internal_segment_table->segment_sizes );
+		}
+		memory_free(
+		 internal_segment_table );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of segments
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_table_get_number_of_segments(
+     libcsplit_segment_table_t *segment_table,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_table_t *internal_segment_table = NULL;
+	static char *function                                      = "libcsplit_segment_table_get_number_of_segments";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_table = (libcsplit_internal_segment_table_t *) segment_table;
+
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = internal_segment_table->number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves the offset and size of a specific segment
+ * The offset and size are relative to the data that was split
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_table_get_segment_by_index(
+     libcsplit_segment_table_t *segment_table,
+     int segment_index,
+     size_t *segment_offset,
+     size_t *segment_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_table_t *internal_segment_table = NULL;
+	static char *function                                      = "libcsplit_segment_table_get_segment_by_index";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_table = (libcsplit_internal_segment_table_t *) segment_table;
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= internal_segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_offset = internal_segment_table->segment_offsets[ segment_index ];
+	*segment_size   = internal_segment_table->segment_sizes[ segment_index ];
+
+	return( 1 );
+}
+
+/* Sets the offset and size of a specific segment
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_segment_table_set_segment_by_index(
+     libcsplit_segment_table_t *segment_table,
+     int segment_index,
+     size_t segment_offset,
+     size_t segment_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_segment_table_t *internal_segment_table = NULL;
+	static char *function                                      = "libcsplit_segment_table_set_segment_by_index";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_table = (libcsplit_internal_segment_table_t *) segment_table;
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= internal_segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_offset > (size_t) SSIZE_MAX )
+	 || ( segment_size > ( (size_t) SSIZE_MAX - segment_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment offset or size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_segment_table->segment_offsets[ segment_index ] = segment_offset;
+	internal_segment_table->segment_sizes[ segment_index ]   = segment_size;
+
+	return( 1 );
+}
+
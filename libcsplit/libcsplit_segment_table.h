@@ -0,0 +1,89 @@
+/*
+ * Segment table functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_INTERNAL_SEGMENT_TABLE_H )
+#define _LIBCSPLIT_INTERNAL_SEGMENT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcsplit_internal_segment_table libcsplit_internal_segment_table_t;
+
+struct libcsplit_internal_segment_table
+{
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The segment offsets
+	 */
+	size_t *segment_offsets;
+
+	/* The segment sizes
+	 */
+	size_t *segment_sizes;
+};
+
+int libcsplit_segment_table_initialize(
+     libcsplit_segment_table_t **segment_table,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_table_free(
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_table_get_number_of_segments(
+     libcsplit_segment_table_t *segment_table,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_segment_table_get_segment_by_index(
+     libcsplit_segment_table_t *segment_table,
+     int segment_index,
+     size_t *segment_offset,
+     size_t *segment_size,
+     libcerror_error_t **error );
+
+int libcsplit_segment_table_set_segment_by_index(
+     libcsplit_segment_table_t *segment_table,
+     int segment_index,
+     size_t segment_offset,
+     size_t segment_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_INTERNAL_SEGMENT_TABLE_H ) */
+
@@ -0,0 +1,644 @@
+/*
+ * Split string serialization functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "csplit_split_string.h"
+#include "libcsplit_definitions.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_serialization.h"
+
+const uint8_t libcsplit_serialization_signature[ 8 ] = {
+	'C', 'S', 'P', 'L', 'T', 'S', 'T', 'R' };
+
+/* Determines the layout of a serialized split string
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_serialization_layout_set(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t character_size,
+     uint8_t flags,
+     uint64_t number_of_segments,
+     uint64_t number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_serialization_layout_set";
+	size_t data_size      = 0;
+	size_t table_size     = 0;
+	uint8_t offset_size   = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( character_size != 1 )
+	 && ( character_size != 2 )
+	 && ( character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size: %" PRIu8 ".",
+		 function,
+		 character_size );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED | LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	/* The segment offsets and sizes are stored in 32-bit when possible to keep
+	 * the table compact, where the largest value is reserved for segments
+	 * that are not set
+	 */
+	if( number_of_characters < (uint64_t) UINT32_MAX )
+	{
+		offset_size = 4;
+	}
+	else
+	{
+		offset_size = 8;
+	}
+	if( number_of_segments > (uint64_t) ( ( SSIZE_MAX - sizeof( csplit_split_string_header_t ) ) / ( 2 * offset_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of segments value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every segment table entry consists of an offset and a size, hence
+	 * the table size is a multiple of 8 bytes and the string data is aligned
+	 */
+	table_size = (size_t) number_of_segments * 2 * offset_size;
+
+	if( number_of_characters > (uint64_t) ( ( SSIZE_MAX - sizeof( csplit_split_string_header_t ) - table_size ) / character_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = (size_t) number_of_characters * character_size;
+
+	layout->character_size       = character_size;
+	layout->offset_size          = offset_size;
+	layout->flags                = flags;
+	layout->number_of_segments   = number_of_segments;
+	layout->number_of_characters = number_of_characters;
+	layout->table_offset         = sizeof( csplit_split_string_header_t );
+	layout->data_offset          = layout->table_offset + table_size;
+	layout->serialized_size      = layout->data_offset + data_size;
+
+	return( 1 );
+}
+
+/* Writes the header of a serialized split string
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_serialization_layout_write_header(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	csplit_split_string_header_t *header = NULL;
+	static char *function                = "libcsplit_serialization_layout_write_header";
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size > (size_t) SSIZE_MAX )
+	 || ( byte_stream_size < layout->serialized_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header = (csplit_split_string_header_t *) byte_stream;
+
+	if( memory_copy(
+	     header->signature,
+	     libcsplit_serialization_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header->format_version,
+	 LIBCSPLIT_SERIALIZATION_FORMAT_VERSION );
+
+	header->character_size = layout->character_size;
+	header->offset_size    = layout->offset_size;
+	header->flags          = layout->flags;
+	header->padding        = 0;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_segments,
+	 layout->number_of_segments );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_characters,
+	 layout->number_of_characters );
+
+	return( 1 );
+}
+
+/* Reads the header of a serialized split string and determines its layout
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_serialization_layout_read_header(
+     libcsplit_serialization_layout_t *layout,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_size,
+     libcerror_error_t **error )
+{
+	csplit_split_string_header_t *header = NULL;
+	static char *function                = "libcsplit_serialization_layout_read_header";
+	uint64_t number_of_characters        = 0;
+	uint64_t number_of_segments          = 0;
+	uint32_t format_version              = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < sizeof( csplit_split_string_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+		 "%s: invalid byte stream - data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	header = (csplit_split_string_header_t *) byte_stream;
+
+	if( memory_compare(
+	     header->signature,
+	     libcsplit_serialization_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_segments,
+	 number_of_segments );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_characters,
+	 number_of_characters );
+
+	if( format_version != LIBCSPLIT_SERIALIZATION_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( header->character_size != character_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character size: %" PRIu8 ".",
+		 function,
+		 header->character_size );
+
+		return( -1 );
+	}
+	if( libcsplit_serialization_layout_set(
+	     layout,
+	     character_size,
+	     header->flags,
+	     number_of_segments,
+	     number_of_characters,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to determine layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->offset_size != layout->offset_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in offset size.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout->serialized_size != byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets an entry in the segment table of a serialized split string
+ * A segment offset of LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET with a size of 0
+ * indicates the segment is not set
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_serialization_layout_set_segment(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t *byte_stream,
+     uint64_t segment_index,
+     uint64_t segment_offset,
+     uint64_t segment_size,
+     libcerror_error_t **error )
+{
+	uint8_t *table_entry  = NULL;
+	static char *function = "libcsplit_serialization_layout_set_segment";
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index >= layout->number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET )
+	{
+		if( segment_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( segment_offset > layout->number_of_characters )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( segment_size > ( layout->number_of_characters - segment_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	table_entry = &( byte_stream[ layout->table_offset + ( (size_t) segment_index * 2 * layout->offset_size ) ] );
+
+	if( layout->offset_size == 4 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 table_entry,
+		 (uint32_t) segment_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( table_entry[ 4 ] ),
+		 (uint32_t) segment_size );
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 table_entry,
+		 segment_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( table_entry[ 8 ] ),
+		 segment_size );
+	}
+	return( 1 );
+}
+
+/* Retrieves an entry from the segment table of a serialized split string
+ * The segment offset is LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET
+ * if the segment is not set
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_serialization_layout_get_segment(
+     libcsplit_serialization_layout_t *layout,
+     const uint8_t *byte_stream,
+     uint64_t segment_index,
+     uint64_t *segment_offset,
+     uint64_t *segment_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *table_entry = NULL;
+	static char *function      = "libcsplit_serialization_layout_get_segment";
+	uint64_t offset_64bit      = 0;
+	uint64_t size_64bit        = 0;
+	uint32_t offset_32bit      = 0;
+	uint32_t size_32bit        = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index >= layout->number_of_segments )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	table_entry = &( byte_stream[ layout->table_offset + ( (size_t) segment_index * 2 * layout->offset_size ) ] );
+
+	if( layout->offset_size == 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 table_entry,
+		 offset_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( table_entry[ 4 ] ),
+		 size_32bit );
+
+		if( offset_32bit == UINT32_MAX )
+		{
+			offset_64bit = LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET;
+		}
+		else
+		{
+			offset_64bit = offset_32bit;
+		}
+		size_64bit = size_32bit;
+	}
+	else
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 table_entry,
+		 offset_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( table_entry[ 8 ] ),
+		 size_64bit );
+	}
+	if( offset_64bit == LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET )
+	{
+		if( size_64bit != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid segment: %" PRIu64 " size value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( offset_64bit > layout->number_of_characters )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid segment: %" PRIu64 " offset value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( size_64bit > ( layout->number_of_characters - offset_64bit ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid segment: %" PRIu64 " size value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	*segment_offset = offset_64bit;
+	*segment_size   = size_64bit;
+
+	return( 1 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Split string serialization functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_SERIALIZATION_H )
+#define _LIBCSPLIT_SERIALIZATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBCSPLIT_SERIALIZATION_FORMAT_VERSION	2
+
+/* The segment offset that indicates the segment is not set
+ */
+#define LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET	(uint64_t) -1
+
+extern const uint8_t libcsplit_serialization_signature[ 8 ];
+
+typedef struct libcsplit_serialization_layout libcsplit_serialization_layout_t;
+
+/* The layout of a serialized split string, which consists of:
+ * the header, the segment table and the string data
+ * The segment table contains an offset and size pair for every segment
+ * and the string data contains the string as-is, including end-of-string characters
+ */
+struct libcsplit_serialization_layout
+{
+	/* The character size
+	 */
+	uint8_t character_size;
+
+	/* The size of an offset or size value in the segment table
+	 */
+	uint8_t offset_size;
+
+	/* The split string flags
+	 */
+	uint8_t flags;
+
+	/* The number of segments
+	 */
+	uint64_t number_of_segments;
+
+	/* The number of characters in the string data
+	 */
+	uint64_t number_of_characters;
+
+	/* The offset of the segment table
+	 */
+	size_t table_offset;
+
+	/* The offset of the string data
+	 */
+	size_t data_offset;
+
+	/* The serialized size
+	 */
+	size_t serialized_size;
+};
+
+int libcsplit_serialization_layout_set(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t character_size,
+     uint8_t flags,
+     uint64_t number_of_segments,
+     uint64_t number_of_characters,
+     libcerror_error_t **error );
+
+int libcsplit_serialization_layout_write_header(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libcsplit_serialization_layout_read_header(
+     libcsplit_serialization_layout_t *layout,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t character_size,
+     libcerror_error_t **error );
+
+int libcsplit_serialization_layout_set_segment(
+     libcsplit_serialization_layout_t *layout,
+     uint8_t *byte_stream,
+     uint64_t segment_index,
+     uint64_t segment_offset,
+     uint64_t segment_size,
+     libcerror_error_t **error );
+
+int libcsplit_serialization_layout_get_segment(
+     libcsplit_serialization_layout_t *layout,
+     const uint8_t *byte_stream,
+     uint64_t segment_index,
+     uint64_t *segment_offset,
+     uint64_t *segment_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_SERIALIZATION_H ) */
+
@@ -0,0 +1,1905 @@
+/*
+ * SIMD code unit search functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libcsplit_simd.h"
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+#include <immintrin.h>
+#endif
+
+/* Searches a string of 16-bit code units for a specific code unit one code unit at a time
+ * Returns a pointer to the code unit or NULL if not found
+ */
+static const uint16_t *libcsplit_simd_search_uint16_scalar(
+                     const uint16_t *string,
+                     uint16_t code_unit,
+                     size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] == code_unit )
+		{
+			return( &( string[ string_index ] ) );
+		}
+	}
+	return( NULL );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a string of 16-bit code units for a specific code unit 8 code units at a time using SSE2
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("sse2")))
+static const uint16_t *libcsplit_simd_search_uint16_sse2(
+                     const uint16_t *string,
+                     uint16_t code_unit,
+                     size_t string_length )
+{
+	__m128i code_units  = _mm_set1_epi16( (short) code_unit );
+	__m128i comparison  = _mm_setzero_si128();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + 8 ) <= string_length )
+	{
+		comparison = _mm_cmpeq_epi16(
+		              _mm_loadu_si128(
+		               (const __m128i *) &( string[ string_index ] ) ),
+		              code_units );
+
+		/* The mask contains 2 bits per matching code unit
+		 */
+		mask = _mm_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 2 ) ] ) );
+		}
+		string_index += 8;
+	}
+	return( libcsplit_simd_search_uint16_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+/* Searches a string of 16-bit code units for a specific code unit 16 code units at a time using AVX2
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("avx2")))
+static const uint16_t *libcsplit_simd_search_uint16_avx2(
+                     const uint16_t *string,
+                     uint16_t code_unit,
+                     size_t string_length )
+{
+	__m256i code_units  = _mm256_set1_epi16( (short) code_unit );
+	__m256i comparison  = _mm256_setzero_si256();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + 16 ) <= string_length )
+	{
+		comparison = _mm256_cmpeq_epi16(
+		              _mm256_loadu_si256(
+		               (const __m256i *) &( string[ string_index ] ) ),
+		              code_units );
+
+		/* The mask contains 2 bits per matching code unit
+		 */
+		mask = _mm256_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 2 ) ] ) );
+		}
+		string_index += 16;
+	}
+	return( libcsplit_simd_search_uint16_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a string of 16-bit code units for a specific code unit
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns a pointer to the code unit or NULL if not found
+ */
+const uint16_t *libcsplit_simd_search_uint16(
+              const uint16_t *string,
+              uint16_t code_unit,
+              size_t string_length )
+{
+	if( string == NULL )
+	{
+		return( NULL );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( string_length >= 8 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_uint16_avx2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_uint16_sse2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_uint16_scalar(
+	         string,
+	         code_unit,
+	         string_length ) );
+}
+
+/* Searches a string of 32-bit code units for a specific code unit one code unit at a time
+ * Returns a pointer to the code unit or NULL if not found
+ */
+static const uint32_t *libcsplit_simd_search_uint32_scalar(
+                     const uint32_t *string,
+                     uint32_t code_unit,
+                     size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] == code_unit )
+		{
+			return( &( string[ string_index ] ) );
+		}
+	}
+	return( NULL );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a string of 32-bit code units for a specific code unit 4 code units at a time using SSE2
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("sse2")))
+static const uint32_t *libcsplit_simd_search_uint32_sse2(
+                     const uint32_t *string,
+                     uint32_t code_unit,
+                     size_t string_length )
+{
+	__m128i code_units  = _mm_set1_epi32( (int) code_unit );
+	__m128i comparison  = _mm_setzero_si128();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + 4 ) <= string_length )
+	{
+		comparison = _mm_cmpeq_epi32(
+		              _mm_loadu_si128(
+		               (const __m128i *) &( string[ string_index ] ) ),
+		              code_units );
+
+		/* The mask contains 4 bits per matching code unit
+		 */
+		mask = _mm_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 4 ) ] ) );
+		}
+		string_index += 4;
+	}
+	return( libcsplit_simd_search_uint32_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+/* Searches a string of 32-bit code units for a specific code unit 8 code units at a time using AVX2
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("avx2")))
+static const uint32_t *libcsplit_simd_search_uint32_avx2(
+                     const uint32_t *string,
+                     uint32_t code_unit,
+                     size_t string_length )
+{
+	__m256i code_units  = _mm256_set1_epi32( (int) code_unit );
+	__m256i comparison  = _mm256_setzero_si256();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + 8 ) <= string_length )
+	{
+		comparison = _mm256_cmpeq_epi32(
+		              _mm256_loadu_si256(
+		               (const __m256i *) &( string[ string_index ] ) ),
+		              code_units );
+
+		/* The mask contains 4 bits per matching code unit
+		 */
+		mask = _mm256_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 4 ) ] ) );
+		}
+		string_index += 8;
+	}
+	return( libcsplit_simd_search_uint32_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a string of 32-bit code units for a specific code unit
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns a pointer to the code unit or NULL if not found
+ */
+const uint32_t *libcsplit_simd_search_uint32(
+              const uint32_t *string,
+              uint32_t code_unit,
+              size_t string_length )
+{
+	if( string == NULL )
+	{
+		return( NULL );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( string_length >= 4 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_uint32_avx2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_uint32_sse2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_uint32_scalar(
+	         string,
+	         code_unit,
+	         string_length ) );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Searches a wide string for a specific code unit one code unit at a time
+ * Returns a pointer to the code unit or NULL if not found
+ */
+static const wchar_t *libcsplit_simd_search_wide_scalar(
+                    const wchar_t *string,
+                    wchar_t code_unit,
+                    size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] == code_unit )
+		{
+			return( &( string[ string_index ] ) );
+		}
+	}
+	return( NULL );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) && ( ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) )
+
+/* Searches a wide string for a specific code unit 16 bytes at a time using SSE2
+ * The code units are only accessed as vectors and as wchar_t
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("sse2")))
+static const wchar_t *libcsplit_simd_search_wide_sse2(
+                    const wchar_t *string,
+                    wchar_t code_unit,
+                    size_t string_length )
+{
+#if SIZEOF_WCHAR_T == 4
+	__m128i code_units  = _mm_set1_epi32( (int) code_unit );
+#else
+	__m128i code_units  = _mm_set1_epi16( (short) code_unit );
+#endif
+	__m128i comparison  = _mm_setzero_si128();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + ( 16 / sizeof( wchar_t ) ) ) <= string_length )
+	{
+#if SIZEOF_WCHAR_T == 4
+		comparison = _mm_cmpeq_epi32(
+		              _mm_loadu_si128(
+		               (const __m128i *) &( string[ string_index ] ) ),
+		              code_units );
+#else
+		comparison = _mm_cmpeq_epi16(
+		              _mm_loadu_si128(
+		               (const __m128i *) &( string[ string_index ] ) ),
+		              code_units );
+#endif
+		/* The mask contains a bit per byte of a matching code unit
+		 */
+		mask = _mm_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / sizeof( wchar_t ) ) ] ) );
+		}
+		string_index += 16 / sizeof( wchar_t );
+	}
+	return( libcsplit_simd_search_wide_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+/* Searches a wide string for a specific code unit 32 bytes at a time using AVX2
+ * The code units are only accessed as vectors and as wchar_t
+ * Returns a pointer to the code unit or NULL if not found
+ */
+__attribute__((target("avx2")))
+static const wchar_t *libcsplit_simd_search_wide_avx2(
+                    const wchar_t *string,
+                    wchar_t code_unit,
+                    size_t string_length )
+{
+#if SIZEOF_WCHAR_T == 4
+	__m256i code_units  = _mm256_set1_epi32( (int) code_unit );
+#else
+	__m256i code_units  = _mm256_set1_epi16( (short) code_unit );
+#endif
+	__m256i comparison  = _mm256_setzero_si256();
+	size_t string_index = 0;
+	int mask            = 0;
+
+	while( ( string_index + ( 32 / sizeof( wchar_t ) ) ) <= string_length )
+	{
+#if SIZEOF_WCHAR_T == 4
+		comparison = _mm256_cmpeq_epi32(
+		              _mm256_loadu_si256(
+		               (const __m256i *) &( string[ string_index ] ) ),
+		              code_units );
+#else
+		comparison = _mm256_cmpeq_epi16(
+		              _mm256_loadu_si256(
+		               (const __m256i *) &( string[ string_index ] ) ),
+		              code_units );
+#endif
+		/* The mask contains a bit per byte of a matching code unit
+		 */
+		mask = _mm256_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / sizeof( wchar_t ) ) ] ) );
+		}
+		string_index += 32 / sizeof( wchar_t );
+	}
+	return( libcsplit_simd_search_wide_scalar(
+	         &( string[ string_index ] ),
+	         code_unit,
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) && ( ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) ) */
+
+/* Searches a wide string for a specific code unit
+ * Unlike casting the string to a string of 16-bit or 32-bit code units, this
+ * does not access wchar_t objects through an incompatible type
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns a pointer to the code unit or NULL if not found
+ */
+const wchar_t *libcsplit_simd_search_wide(
+               const wchar_t *string,
+               wchar_t code_unit,
+               size_t string_length )
+{
+	if( string == NULL )
+	{
+		return( NULL );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) && ( ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) )
+	if( string_length >= ( 16 / sizeof( wchar_t ) ) )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_wide_avx2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_wide_sse2(
+			         string,
+			         code_unit,
+			         string_length ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) && ( ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 ) ) */
+
+	return( libcsplit_simd_search_wide_scalar(
+	         string,
+	         code_unit,
+	         string_length ) );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Searches a byte stream of 16-bit little-endian code units for a specific code unit one code unit at a time
+ * Returns a pointer to the first byte of the code unit or NULL if not found
+ */
+static const uint8_t *libcsplit_simd_search_uint16_little_endian_scalar(
+                    const uint8_t *byte_stream,
+                    uint16_t code_unit,
+                    size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+	uint16_t value_16bit      = 0;
+
+	for( byte_stream_offset = 0;
+	     ( byte_stream_offset + 1 ) < byte_stream_size;
+	     byte_stream_offset += 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 value_16bit );
+
+		if( value_16bit == code_unit )
+		{
+			return( &( byte_stream[ byte_stream_offset ] ) );
+		}
+	}
+	return( NULL );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a byte stream of 16-bit little-endian code units for a specific code unit 8 code units at a time using SSE2
+ * x86 is little-endian hence the code units can be compared without conversion
+ * Returns a pointer to the first byte of the code unit or NULL if not found
+ */
+__attribute__((target("sse2")))
+static const uint8_t *libcsplit_simd_search_uint16_little_endian_sse2(
+                    const uint8_t *byte_stream,
+                    uint16_t code_unit,
+                    size_t byte_stream_size )
+{
+	__m128i code_units        = _mm_set1_epi16( (short) code_unit );
+	__m128i comparison        = _mm_setzero_si128();
+	size_t byte_stream_offset = 0;
+	int mask                  = 0;
+
+	while( ( byte_stream_offset + 16 ) <= byte_stream_size )
+	{
+		comparison = _mm_cmpeq_epi16(
+		              _mm_loadu_si128(
+		               (const __m128i *) &( byte_stream[ byte_stream_offset ] ) ),
+		              code_units );
+
+		mask = _mm_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( byte_stream[ byte_stream_offset + __builtin_ctz( (unsigned int) mask ) ] ) );
+		}
+		byte_stream_offset += 16;
+	}
+	return( libcsplit_simd_search_uint16_little_endian_scalar(
+	         &( byte_stream[ byte_stream_offset ] ),
+	         code_unit,
+	         byte_stream_size - byte_stream_offset ) );
+}
+
+/* Searches a byte stream of 16-bit little-endian code units for a specific code unit 16 code units at a time using AVX2
+ * x86 is little-endian hence the code units can be compared without conversion
+ * Returns a pointer to the first byte of the code unit or NULL if not found
+ */
+__attribute__((target("avx2")))
+static const uint8_t *libcsplit_simd_search_uint16_little_endian_avx2(
+                    const uint8_t *byte_stream,
+                    uint16_t code_unit,
+                    size_t byte_stream_size )
+{
+	__m256i code_units        = _mm256_set1_epi16( (short) code_unit );
+	__m256i comparison        = _mm256_setzero_si256();
+	size_t byte_stream_offset = 0;
+	int mask                  = 0;
+
+	while( ( byte_stream_offset + 32 ) <= byte_stream_size )
+	{
+		comparison = _mm256_cmpeq_epi16(
+		              _mm256_loadu_si256(
+		               (const __m256i *) &( byte_stream[ byte_stream_offset ] ) ),
+		              code_units );
+
+		mask = _mm256_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( byte_stream[ byte_stream_offset + __builtin_ctz( (unsigned int) mask ) ] ) );
+		}
+		byte_stream_offset += 32;
+	}
+	return( libcsplit_simd_search_uint16_little_endian_scalar(
+	         &( byte_stream[ byte_stream_offset ] ),
+	         code_unit,
+	         byte_stream_size - byte_stream_offset ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a byte stream of 16-bit little-endian code units for a specific code unit
+ * Only code units at even offsets are compared, a trailing odd byte is ignored
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns a pointer to the first byte of the code unit or NULL if not found
+ */
+const uint8_t *libcsplit_simd_search_uint16_little_endian(
+             const uint8_t *byte_stream,
+             uint16_t code_unit,
+             size_t byte_stream_size )
+{
+	if( byte_stream == NULL )
+	{
+		return( NULL );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 16 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_uint16_little_endian_avx2(
+			         byte_stream,
+			         code_unit,
+			         byte_stream_size ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_uint16_little_endian_sse2(
+			         byte_stream,
+			         code_unit,
+			         byte_stream_size ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_uint16_little_endian_scalar(
+	         byte_stream,
+	         code_unit,
+	         byte_stream_size ) );
+}
+
+/* Determines the number of leading ASCII bytes that are not 0 or a specific stop byte one byte at a time
+ * Returns the number of bytes
+ */
+static size_t libcsplit_simd_span_ascii_scalar(
+               const uint8_t *byte_stream,
+               uint8_t stop_byte,
+               size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		if( ( byte_stream[ byte_stream_offset ] == 0 )
+		 || ( byte_stream[ byte_stream_offset ] == stop_byte )
+		 || ( byte_stream[ byte_stream_offset ] >= 0x80 ) )
+		{
+			break;
+		}
+	}
+	return( byte_stream_offset );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Determines the number of leading ASCII bytes that are not 0 or a specific stop byte 16 bytes at a time using SSE2
+ * The most significant bit of every byte is combined with the comparisons in a single mask
+ * Returns the number of bytes
+ */
+__attribute__((target("sse2")))
+static size_t libcsplit_simd_span_ascii_sse2(
+               const uint8_t *byte_stream,
+               uint8_t stop_byte,
+               size_t byte_stream_size )
+{
+	__m128i stop_bytes        = _mm_set1_epi8( (char) stop_byte );
+	__m128i zero_bytes        = _mm_setzero_si128();
+	__m128i bytes             = _mm_setzero_si128();
+	size_t byte_stream_offset = 0;
+	int mask                  = 0;
+
+	while( ( byte_stream_offset + 16 ) <= byte_stream_size )
+	{
+		bytes = _mm_loadu_si128(
+		         (const __m128i *) &( byte_stream[ byte_stream_offset ] ) );
+
+		mask = _mm_movemask_epi8(
+		        _mm_or_si128(
+		         bytes,
+		         _mm_or_si128(
+		          _mm_cmpeq_epi8(
+		           bytes,
+		           zero_bytes ),
+		          _mm_cmpeq_epi8(
+		           bytes,
+		           stop_bytes ) ) ) );
+
+		if( mask != 0 )
+		{
+			return( byte_stream_offset + __builtin_ctz( (unsigned int) mask ) );
+		}
+		byte_stream_offset += 16;
+	}
+	return( byte_stream_offset + libcsplit_simd_span_ascii_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              stop_byte,
+	                              byte_stream_size - byte_stream_offset ) );
+}
+
+/* Determines the number of leading ASCII bytes that are not 0 or a specific stop byte 32 bytes at a time using AVX2
+ * The most significant bit of every byte is combined with the comparisons in a single mask
+ * Returns the number of bytes
+ */
+__attribute__((target("avx2")))
+static size_t libcsplit_simd_span_ascii_avx2(
+               const uint8_t *byte_stream,
+               uint8_t stop_byte,
+               size_t byte_stream_size )
+{
+	__m256i stop_bytes        = _mm256_set1_epi8( (char) stop_byte );
+	__m256i zero_bytes        = _mm256_setzero_si256();
+	__m256i bytes             = _mm256_setzero_si256();
+	size_t byte_stream_offset = 0;
+	int mask                  = 0;
+
+	while( ( byte_stream_offset + 32 ) <= byte_stream_size )
+	{
+		bytes = _mm256_loadu_si256(
+		         (const __m256i *) &( byte_stream[ byte_stream_offset ] ) );
+
+		mask = _mm256_movemask_epi8(
+		        _mm256_or_si256(
+		         bytes,
+		         _mm256_or_si256(
+		          _mm256_cmpeq_epi8(
+		           bytes,
+		           zero_bytes ),
+		          _mm256_cmpeq_epi8(
+		           bytes,
+		           stop_bytes ) ) ) );
+
+		if( mask != 0 )
+		{
+			return( byte_stream_offset + __builtin_ctz( (unsigned int) mask ) );
+		}
+		byte_stream_offset += 32;
+	}
+	return( byte_stream_offset + libcsplit_simd_span_ascii_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              stop_byte,
+	                              byte_stream_size - byte_stream_offset ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Determines the number of leading ASCII bytes that are not 0 or a specific stop byte
+ * This is used to skip over runs of ASCII characters that need no further inspection
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns the number of bytes
+ */
+size_t libcsplit_simd_span_ascii(
+        const uint8_t *byte_stream,
+        uint8_t stop_byte,
+        size_t byte_stream_size )
+{
+	if( byte_stream == NULL )
+	{
+		return( 0 );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 16 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_span_ascii_avx2(
+			         byte_stream,
+			         stop_byte,
+			         byte_stream_size ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_span_ascii_sse2(
+			         byte_stream,
+			         stop_byte,
+			         byte_stream_size ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_span_ascii_scalar(
+	         byte_stream,
+	         stop_byte,
+	         byte_stream_size ) );
+}
+
+/* Searches a string of 16-bit code units for a specific pair of code units one code unit at a time
+ * Returns a pointer to the first code unit of the pair or NULL if not found
+ */
+static const uint16_t *libcsplit_simd_search_uint16_pair_scalar(
+                     const uint16_t *string,
+                     uint16_t first_code_unit,
+                     uint16_t second_code_unit,
+                     size_t string_length )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     ( string_index + 1 ) < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == first_code_unit )
+		 && ( string[ string_index + 1 ] == second_code_unit ) )
+		{
+			return( &( string[ string_index ] ) );
+		}
+	}
+	return( NULL );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a string of 16-bit code units for a specific pair of code units 8 code units at a time using SSE2
+ * The first code units are compared against the vector at the current position and the second
+ * code units against the vector one code unit further, hence both comparisons share the same lanes
+ * Returns a pointer to the first code unit of the pair or NULL if not found
+ */
+__attribute__((target("sse2")))
+static const uint16_t *libcsplit_simd_search_uint16_pair_sse2(
+                     const uint16_t *string,
+                     uint16_t first_code_unit,
+                     uint16_t second_code_unit,
+                     size_t string_length )
+{
+	__m128i first_code_units  = _mm_set1_epi16( (short) first_code_unit );
+	__m128i second_code_units = _mm_set1_epi16( (short) second_code_unit );
+	__m128i comparison        = _mm_setzero_si128();
+	size_t string_index       = 0;
+	int mask                  = 0;
+
+	while( ( string_index + 9 ) <= string_length )
+	{
+		comparison = _mm_and_si128(
+		              _mm_cmpeq_epi16(
+		               _mm_loadu_si128(
+		                (const __m128i *) &( string[ string_index ] ) ),
+		               first_code_units ),
+		              _mm_cmpeq_epi16(
+		               _mm_loadu_si128(
+		                (const __m128i *) &( string[ string_index + 1 ] ) ),
+		               second_code_units ) );
+
+		mask = _mm_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 2 ) ] ) );
+		}
+		string_index += 8;
+	}
+	return( libcsplit_simd_search_uint16_pair_scalar(
+	         &( string[ string_index ] ),
+	         first_code_unit,
+	         second_code_unit,
+	         string_length - string_index ) );
+}
+
+/* Searches a string of 16-bit code units for a specific pair of code units 16 code units at a time using AVX2
+ * The first code units are compared against the vector at the current position and the second
+ * code units against the vector one code unit further, hence both comparisons share the same lanes
+ * Returns a pointer to the first code unit of the pair or NULL if not found
+ */
+__attribute__((target("avx2")))
+static const uint16_t *libcsplit_simd_search_uint16_pair_avx2(
+                     const uint16_t *string,
+                     uint16_t first_code_unit,
+                     uint16_t second_code_unit,
+                     size_t string_length )
+{
+	__m256i first_code_units  = _mm256_set1_epi16( (short) first_code_unit );
+	__m256i second_code_units = _mm256_set1_epi16( (short) second_code_unit );
+	__m256i comparison        = _mm256_setzero_si256();
+	size_t string_index       = 0;
+	int mask                  = 0;
+
+	while( ( string_index + 17 ) <= string_length )
+	{
+		comparison = _mm256_and_si256(
+		              _mm256_cmpeq_epi16(
+		               _mm256_loadu_si256(
+		                (const __m256i *) &( string[ string_index ] ) ),
+		               first_code_units ),
+		              _mm256_cmpeq_epi16(
+		               _mm256_loadu_si256(
+		                (const __m256i *) &( string[ string_index + 1 ] ) ),
+		               second_code_units ) );
+
+		mask = _mm256_movemask_epi8(
+		        comparison );
+
+		if( mask != 0 )
+		{
+			return( &( string[ string_index + ( __builtin_ctz( (unsigned int) mask ) / 2 ) ] ) );
+		}
+		string_index += 16;
+	}
+	return( libcsplit_simd_search_uint16_pair_scalar(
+	         &( string[ string_index ] ),
+	         first_code_unit,
+	         second_code_unit,
+	         string_length - string_index ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a string of 16-bit code units for a specific pair of code units, such as a surrogate pair
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns a pointer to the first code unit of the pair or NULL if not found
+ */
+const uint16_t *libcsplit_simd_search_uint16_pair(
+              const uint16_t *string,
+              uint16_t first_code_unit,
+              uint16_t second_code_unit,
+              size_t string_length )
+{
+	if( string == NULL )
+	{
+		return( NULL );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( string_length > 8 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_uint16_pair_avx2(
+			         string,
+			         first_code_unit,
+			         second_code_unit,
+			         string_length ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_uint16_pair_sse2(
+			         string,
+			         first_code_unit,
+			         second_code_unit,
+			         string_length ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_uint16_pair_scalar(
+	         string,
+	         first_code_unit,
+	         second_code_unit,
+	         string_length ) );
+}
+
+/* Searches a byte stream for a delimiter byte that is not enclosed in quotes one byte at a time
+ * Every quote byte toggles the quote state, hence an escaped quote that is
+ * doubled toggles the quote state twice
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+static size_t libcsplit_simd_search_unquoted_scalar(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t quote,
+               size_t byte_stream_size,
+               uint8_t *quote_state )
+{
+	size_t byte_stream_offset = 0;
+	uint8_t in_quotes         = *quote_state;
+
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		if( byte_stream[ byte_stream_offset ] == quote )
+		{
+			in_quotes ^= 1;
+		}
+		else if( ( in_quotes == 0 )
+		      && ( byte_stream[ byte_stream_offset ] == delimiter ) )
+		{
+			break;
+		}
+	}
+	*quote_state = in_quotes;
+
+	return( byte_stream_offset );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Determines the masks of the bytes in a 64-byte block that match either of two byte values using SSE2
+ * Bit N of a mask is set if byte N of the block matches the value
+ */
+__attribute__((target("sse2")))
+static void libcsplit_simd_get_block_masks_sse2(
+             const uint8_t *block,
+             __m128i first_bytes,
+             __m128i second_bytes,
+             uint64_t *first_mask,
+             uint64_t *second_mask )
+{
+	__m128i bytes        = _mm_setzero_si128();
+	int block_offset     = 0;
+	uint64_t mask_first  = 0;
+	uint64_t mask_second = 0;
+
+	for( block_offset = 0;
+	     block_offset < 64;
+	     block_offset += 16 )
+	{
+		bytes = _mm_loadu_si128(
+		         (const __m128i *) &( block[ block_offset ] ) );
+
+		mask_first |= (uint64_t) (uint16_t) _mm_movemask_epi8(
+		                                     _mm_cmpeq_epi8(
+		                                      bytes,
+		                                      first_bytes ) ) << block_offset;
+
+		mask_second |= (uint64_t) (uint16_t) _mm_movemask_epi8(
+		                                      _mm_cmpeq_epi8(
+		                                       bytes,
+		                                       second_bytes ) ) << block_offset;
+	}
+	*first_mask  = mask_first;
+	*second_mask = mask_second;
+}
+
+/* Determines the masks of the bytes in a 64-byte block that match either of two byte values using AVX2
+ * Bit N of a mask is set if byte N of the block matches the value
+ */
+__attribute__((target("avx2")))
+static void libcsplit_simd_get_block_masks_avx2(
+             const uint8_t *block,
+             __m256i first_bytes,
+             __m256i second_bytes,
+             uint64_t *first_mask,
+             uint64_t *second_mask )
+{
+	__m256i bytes        = _mm256_setzero_si256();
+	int block_offset     = 0;
+	uint64_t mask_first  = 0;
+	uint64_t mask_second = 0;
+
+	for( block_offset = 0;
+	     block_offset < 64;
+	     block_offset += 32 )
+	{
+		bytes = _mm256_loadu_si256(
+		         (const __m256i *) &( block[ block_offset ] ) );
+
+		mask_first |= (uint64_t) (uint32_t) _mm256_movemask_epi8(
+		                                     _mm256_cmpeq_epi8(
+		                                      bytes,
+		                                      first_bytes ) ) << block_offset;
+
+		mask_second |= (uint64_t) (uint32_t) _mm256_movemask_epi8(
+		                                      _mm256_cmpeq_epi8(
+		                                       bytes,
+		                                       second_bytes ) ) << block_offset;
+	}
+	*first_mask  = mask_first;
+	*second_mask = mask_second;
+}
+
+/* Searches a byte stream for a delimiter byte that is not enclosed in quotes 64 bytes at a time using SSE2
+ * The bits of the quoted bytes are determined with a prefix XOR over the quote
+ * byte mask, which is computed with shifts
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+__attribute__((target("sse2")))
+static size_t libcsplit_simd_search_unquoted_sse2(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t quote,
+               size_t byte_stream_size,
+               uint8_t *quote_state )
+{
+	__m128i delimiter_bytes   = _mm_set1_epi8( (char) delimiter );
+	__m128i quote_bytes       = _mm_set1_epi8( (char) quote );
+	size_t byte_stream_offset = 0;
+	uint64_t delimiter_mask   = 0;
+	uint64_t quote_mask       = 0;
+	uint64_t quoted_mask      = 0;
+	uint64_t quoted_carry     = 0;
+
+	if( *quote_state != 0 )
+	{
+		quoted_carry = ~( (uint64_t) 0 );
+	}
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		libcsplit_simd_get_block_masks_sse2(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 delimiter_bytes,
+		 quote_bytes,
+		 &delimiter_mask,
+		 &quote_mask );
+
+		quoted_mask  = quote_mask ^ ( quote_mask << 1 );
+		quoted_mask ^= quoted_mask << 2;
+		quoted_mask ^= quoted_mask << 4;
+		quoted_mask ^= quoted_mask << 8;
+		quoted_mask ^= quoted_mask << 16;
+		quoted_mask ^= quoted_mask << 32;
+		quoted_mask ^= quoted_carry;
+
+		delimiter_mask &= ~quoted_mask;
+
+		if( delimiter_mask != 0 )
+		{
+			*quote_state = 0;
+
+			return( byte_stream_offset + __builtin_ctzll( delimiter_mask ) );
+		}
+		quoted_carry = (uint64_t) ( (int64_t) quoted_mask >> 63 );
+
+		byte_stream_offset += 64;
+	}
+	*quote_state = (uint8_t) ( quoted_carry & 1 );
+
+	return( byte_stream_offset + libcsplit_simd_search_unquoted_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              delimiter,
+	                              quote,
+	                              byte_stream_size - byte_stream_offset,
+	                              quote_state ) );
+}
+
+/* Searches a byte stream for a delimiter byte that is not enclosed in quotes 64 bytes at a time using AVX2
+ * The bits of the quoted bytes are determined with a prefix XOR over the quote
+ * byte mask, which is computed with a carry-less multiplication by all ones
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+__attribute__((target("avx2,pclmul")))
+static size_t libcsplit_simd_search_unquoted_avx2(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t quote,
+               size_t byte_stream_size,
+               uint8_t *quote_state )
+{
+	__m256i delimiter_bytes   = _mm256_set1_epi8( (char) delimiter );
+	__m256i quote_bytes       = _mm256_set1_epi8( (char) quote );
+	__m128i all_ones          = _mm_set1_epi8( (char) 0xff );
+	size_t byte_stream_offset = 0;
+	uint64_t delimiter_mask   = 0;
+	uint64_t quote_mask       = 0;
+	uint64_t quoted_mask      = 0;
+	uint64_t quoted_carry     = 0;
+
+	if( *quote_state != 0 )
+	{
+		quoted_carry = ~( (uint64_t) 0 );
+	}
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		libcsplit_simd_get_block_masks_avx2(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 delimiter_bytes,
+		 quote_bytes,
+		 &delimiter_mask,
+		 &quote_mask );
+
+		_mm_storel_epi64(
+		 (__m128i *) &quoted_mask,
+		 _mm_clmulepi64_si128(
+		  _mm_set_epi64x(
+		   0,
+		   (long long) quote_mask ),
+		  all_ones,
+		  0 ) );
+
+		quoted_mask ^= quoted_carry;
+
+		delimiter_mask &= ~quoted_mask;
+
+		if( delimiter_mask != 0 )
+		{
+			*quote_state = 0;
+
+			return( byte_stream_offset + __builtin_ctzll( delimiter_mask ) );
+		}
+		quoted_carry = (uint64_t) ( (int64_t) quoted_mask >> 63 );
+
+		byte_stream_offset += 64;
+	}
+	*quote_state = (uint8_t) ( quoted_carry & 1 );
+
+	return( byte_stream_offset + libcsplit_simd_search_unquoted_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              delimiter,
+	                              quote,
+	                              byte_stream_size - byte_stream_offset,
+	                              quote_state ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a byte stream for a delimiter byte that is not enclosed in quotes
+ * The quote state is 1 if the start of the byte stream is enclosed in quotes
+ * or 0 if not, and is updated to the quote state at the returned offset
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+size_t libcsplit_simd_search_unquoted(
+        const uint8_t *byte_stream,
+        uint8_t delimiter,
+        uint8_t quote,
+        size_t byte_stream_size,
+        uint8_t *quote_state )
+{
+	if( ( byte_stream == NULL )
+	 || ( quote_state == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 64 )
+	{
+		if( __builtin_cpu_supports( "avx2" )
+		 && __builtin_cpu_supports( "pclmul" ) )
+		{
+			return( libcsplit_simd_search_unquoted_avx2(
+			         byte_stream,
+			         delimiter,
+			         quote,
+			         byte_stream_size,
+			         quote_state ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_unquoted_sse2(
+			         byte_stream,
+			         delimiter,
+			         quote,
+			         byte_stream_size,
+			         quote_state ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_unquoted_scalar(
+	         byte_stream,
+	         delimiter,
+	         quote,
+	         byte_stream_size,
+	         quote_state ) );
+}
+
+/* Searches a byte stream for a delimiter byte that is not escaped one byte at a time
+ * An escape byte that is not escaped itself escapes the byte that follows it
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+static size_t libcsplit_simd_search_unescaped_scalar(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t escape,
+               size_t byte_stream_size,
+               uint8_t *escape_state )
+{
+	size_t byte_stream_offset = 0;
+	uint8_t is_escaped        = *escape_state;
+
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		if( is_escaped != 0 )
+		{
+			is_escaped = 0;
+		}
+		else if( byte_stream[ byte_stream_offset ] == escape )
+		{
+			is_escaped = 1;
+		}
+		else if( byte_stream[ byte_stream_offset ] == delimiter )
+		{
+			break;
+		}
+	}
+	*escape_state = is_escaped;
+
+	return( byte_stream_offset );
+}
+
+/* Determines the mask of the escaped bytes in a 64-byte block
+ * The escape carry is 1 if the first byte of the block is escaped and is set
+ * to 1 if the first byte of the next block is escaped
+ * An escape byte escapes the byte that follows it if it is at an odd offset
+ * within its run of escape bytes, counted from 1. The runs starting at even
+ * and odd bit positions are isolated by adding their start bits, which clears
+ * every run and sets the bit that follows it, the escaped bytes are at the
+ * bit positions with the opposite parity of the start of their run
+ * Returns the mask of the escaped bytes
+ */
+static uint64_t libcsplit_simd_get_escaped_mask(
+                 uint64_t escape_mask,
+                 uint64_t *escape_carry )
+{
+	uint64_t even_bits       = 0x5555555555555555ULL;
+	uint64_t escaped_mask    = 0;
+	uint64_t even_runs_mask  = 0;
+	uint64_t odd_runs_mask   = 0;
+	uint64_t odd_runs_sum    = 0;
+	uint64_t run_starts_mask = 0;
+
+	/* An escape byte that is escaped does not start or continue a run
+	 */
+	escaped_mask = *escape_carry;
+	escape_mask &= ~escaped_mask;
+
+	run_starts_mask = escape_mask & ~( escape_mask << 1 );
+
+	even_runs_mask = ( escape_mask + ( run_starts_mask & even_bits ) ) ^ escape_mask;
+	odd_runs_sum   = escape_mask + ( run_starts_mask & ~even_bits );
+	odd_runs_mask  = odd_runs_sum ^ escape_mask;
+
+	escaped_mask |= ( even_runs_mask & ~even_bits )
+	              | ( odd_runs_mask & even_bits );
+
+	/* A run that starts at an odd bit position and ends at the last bit escapes
+	 * the first byte of the next block
+	 */
+	*escape_carry = (uint64_t) ( odd_runs_sum < escape_mask );
+
+	return( escaped_mask );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a byte stream for a delimiter byte that is not escaped 64 bytes at a time using SSE2
+ * The escaped bytes are determined from the escape byte mask without a per byte state
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+__attribute__((target("sse2")))
+static size_t libcsplit_simd_search_unescaped_sse2(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t escape,
+               size_t byte_stream_size,
+               uint8_t *escape_state )
+{
+	__m128i delimiter_bytes   = _mm_set1_epi8( (char) delimiter );
+	__m128i escape_bytes      = _mm_set1_epi8( (char) escape );
+	size_t byte_stream_offset = 0;
+	uint64_t delimiter_mask   = 0;
+	uint64_t escape_carry     = (uint64_t) *escape_state;
+	uint64_t escape_mask      = 0;
+
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		libcsplit_simd_get_block_masks_sse2(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 delimiter_bytes,
+		 escape_bytes,
+		 &delimiter_mask,
+		 &escape_mask );
+
+		delimiter_mask &= ~libcsplit_simd_get_escaped_mask(
+		                    escape_mask,
+		                    &escape_carry );
+
+		if( delimiter_mask != 0 )
+		{
+			*escape_state = 0;
+
+			return( byte_stream_offset + __builtin_ctzll( delimiter_mask ) );
+		}
+		byte_stream_offset += 64;
+	}
+	*escape_state = (uint8_t) escape_carry;
+
+	return( byte_stream_offset + libcsplit_simd_search_unescaped_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              delimiter,
+	                              escape,
+	                              byte_stream_size - byte_stream_offset,
+	                              escape_state ) );
+}
+
+/* Searches a byte stream for a delimiter byte that is not escaped 64 bytes at a time using AVX2
+ * The escaped bytes are determined from the escape byte mask without a per byte state
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libcsplit_simd_search_unescaped_avx2(
+               const uint8_t *byte_stream,
+               uint8_t delimiter,
+               uint8_t escape,
+               size_t byte_stream_size,
+               uint8_t *escape_state )
+{
+	__m256i delimiter_bytes   = _mm256_set1_epi8( (char) delimiter );
+	__m256i escape_bytes      = _mm256_set1_epi8( (char) escape );
+	size_t byte_stream_offset = 0;
+	uint64_t delimiter_mask   = 0;
+	uint64_t escape_carry     = (uint64_t) *escape_state;
+	uint64_t escape_mask      = 0;
+
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		libcsplit_simd_get_block_masks_avx2(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 delimiter_bytes,
+		 escape_bytes,
+		 &delimiter_mask,
+		 &escape_mask );
+
+		delimiter_mask &= ~libcsplit_simd_get_escaped_mask(
+		                    escape_mask,
+		                    &escape_carry );
+
+		if( delimiter_mask != 0 )
+		{
+			*escape_state = 0;
+
+			return( byte_stream_offset + __builtin_ctzll( delimiter_mask ) );
+		}
+		byte_stream_offset += 64;
+	}
+	*escape_state = (uint8_t) escape_carry;
+
+	return( byte_stream_offset + libcsplit_simd_search_unescaped_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              delimiter,
+	                              escape,
+	                              byte_stream_size - byte_stream_offset,
+	                              escape_state ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a byte stream for a delimiter byte that is not escaped
+ * The escape state is 1 if the first byte of the byte stream is escaped
+ * or 0 if not, and is updated to the escape state at the returned offset
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns the offset of the delimiter byte or byte_stream_size if not found
+ */
+size_t libcsplit_simd_search_unescaped(
+        const uint8_t *byte_stream,
+        uint8_t delimiter,
+        uint8_t escape,
+        size_t byte_stream_size,
+        uint8_t *escape_state )
+{
+	if( ( byte_stream == NULL )
+	 || ( escape_state == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 64 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_unescaped_avx2(
+			         byte_stream,
+			         delimiter,
+			         escape,
+			         byte_stream_size,
+			         escape_state ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_unescaped_sse2(
+			         byte_stream,
+			         delimiter,
+			         escape,
+			         byte_stream_size,
+			         escape_state ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_unescaped_scalar(
+	         byte_stream,
+	         delimiter,
+	         escape,
+	         byte_stream_size,
+	         escape_state ) );
+}
+
+/* Determines if a byte is an ASCII whitespace character
+ * The whitespace characters are space, horizontal tab, line feed, vertical tab,
+ * form feed and carriage return
+ */
+#define LIBCSPLIT_SIMD_IS_WHITESPACE( byte ) \
+	( ( ( byte ) == (uint8_t) ' ' ) || ( ( (uint8_t) ( ( byte ) - 0x09 ) ) <= 0x04 ) )
+
+/* Searches a byte stream for the first byte that differs in whitespace class from the preceding byte one byte at a time
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+static size_t libcsplit_simd_search_whitespace_transition_scalar(
+               const uint8_t *byte_stream,
+               size_t byte_stream_size,
+               uint8_t *whitespace_state )
+{
+	size_t byte_stream_offset = 0;
+	uint8_t is_whitespace     = 0;
+
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		is_whitespace = (uint8_t) LIBCSPLIT_SIMD_IS_WHITESPACE( byte_stream[ byte_stream_offset ] );
+
+		if( is_whitespace != *whitespace_state )
+		{
+			*whitespace_state = is_whitespace;
+
+			break;
+		}
+	}
+	return( byte_stream_offset );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Determines the mask of the whitespace bytes in a 64-byte block using SSE2
+ * The range of horizontal tab to carriage return is matched with an unsigned minimum
+ * Returns the mask of the whitespace bytes
+ */
+__attribute__((target("sse2")))
+static uint64_t libcsplit_simd_get_whitespace_mask_sse2(
+                 const uint8_t *block )
+{
+	__m128i control_bytes = _mm_set1_epi8( 0x09 );
+	__m128i range_bytes   = _mm_set1_epi8( 0x04 );
+	__m128i space_bytes   = _mm_set1_epi8( ' ' );
+	__m128i bytes         = _mm_setzero_si128();
+	uint64_t mask         = 0;
+	int block_offset      = 0;
+
+	for( block_offset = 0;
+	     block_offset < 64;
+	     block_offset += 16 )
+	{
+		bytes = _mm_loadu_si128(
+		         (const __m128i *) &( block[ block_offset ] ) );
+
+		mask |= (uint64_t) (uint16_t) _mm_movemask_epi8(
+		                               _mm_or_si128(
+		                                _mm_cmpeq_epi8(
+		                                 bytes,
+		                                 space_bytes ),
+		                                _mm_cmpeq_epi8(
+		                                 _mm_min_epu8(
+		                                  _mm_sub_epi8(
+		                                   bytes,
+		                                   control_bytes ),
+		                                  range_bytes ),
+		                                 _mm_sub_epi8(
+		                                  bytes,
+		                                  control_bytes ) ) ) ) << block_offset;
+	}
+	return( mask );
+}
+
+/* Determines the mask of the whitespace bytes in a 64-byte block using AVX2
+ * The range of horizontal tab to carriage return is matched with an unsigned minimum
+ * Returns the mask of the whitespace bytes
+ */
+__attribute__((target("avx2")))
+static uint64_t libcsplit_simd_get_whitespace_mask_avx2(
+                 const uint8_t *block )
+{
+	__m256i control_bytes = _mm256_set1_epi8( 0x09 );
+	__m256i range_bytes   = _mm256_set1_epi8( 0x04 );
+	__m256i space_bytes   = _mm256_set1_epi8( ' ' );
+	__m256i bytes         = _mm256_setzero_si256();
+	uint64_t mask         = 0;
+	int block_offset      = 0;
+
+	for( block_offset = 0;
+	     block_offset < 64;
+	     block_offset += 32 )
+	{
+		bytes = _mm256_loadu_si256(
+		         (const __m256i *) &( block[ block_offset ] ) );
+
+		mask |= (uint64_t) (uint32_t) _mm256_movemask_epi8(
+		                               _mm256_or_si256(
+		                                _mm256_cmpeq_epi8(
+		                                 bytes,
+		                                 space_bytes ),
+		                                _mm256_cmpeq_epi8(
+		                                 _mm256_min_epu8(
+		                                  _mm256_sub_epi8(
+		                                   bytes,
+		                                   control_bytes ),
+		                                  range_bytes ),
+		                                 _mm256_sub_epi8(
+		                                  bytes,
+		                                  control_bytes ) ) ) ) << block_offset;
+	}
+	return( mask );
+}
+
+/* Searches a byte stream for the first byte that differs in whitespace class from the preceding byte 64 bytes at a time using SSE2
+ * The transitions are the bits that differ between the whitespace mask and
+ * the whitespace mask shifted by one byte
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+__attribute__((target("sse2")))
+static size_t libcsplit_simd_search_whitespace_transition_sse2(
+               const uint8_t *byte_stream,
+               size_t byte_stream_size,
+               uint8_t *whitespace_state )
+{
+	size_t byte_stream_offset = 0;
+	uint64_t transition_mask  = 0;
+	uint64_t whitespace_mask  = 0;
+
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		whitespace_mask = libcsplit_simd_get_whitespace_mask_sse2(
+		                   &( byte_stream[ byte_stream_offset ] ) );
+
+		transition_mask = whitespace_mask ^ ( ( whitespace_mask << 1 ) | *whitespace_state );
+
+		if( transition_mask != 0 )
+		{
+			*whitespace_state ^= 1;
+
+			return( byte_stream_offset + __builtin_ctzll( transition_mask ) );
+		}
+		byte_stream_offset += 64;
+	}
+	return( byte_stream_offset + libcsplit_simd_search_whitespace_transition_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              byte_stream_size - byte_stream_offset,
+	                              whitespace_state ) );
+}
+
+/* Searches a byte stream for the first byte that differs in whitespace class from the preceding byte 64 bytes at a time using AVX2
+ * The transitions are the bits that differ between the whitespace mask and
+ * the whitespace mask shifted by one byte
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libcsplit_simd_search_whitespace_transition_avx2(
+               const uint8_t *byte_stream,
+               size_t byte_stream_size,
+               uint8_t *whitespace_state )
+{
+	size_t byte_stream_offset = 0;
+	uint64_t transition_mask  = 0;
+	uint64_t whitespace_mask  = 0;
+
+	while( ( byte_stream_offset + 64 ) <= byte_stream_size )
+	{
+		whitespace_mask = libcsplit_simd_get_whitespace_mask_avx2(
+		                   &( byte_stream[ byte_stream_offset ] ) );
+
+		transition_mask = whitespace_mask ^ ( ( whitespace_mask << 1 ) | *whitespace_state );
+
+		if( transition_mask != 0 )
+		{
+			*whitespace_state ^= 1;
+
+			return( byte_stream_offset + __builtin_ctzll( transition_mask ) );
+		}
+		byte_stream_offset += 64;
+	}
+	return( byte_stream_offset + libcsplit_simd_search_whitespace_transition_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              byte_stream_size - byte_stream_offset,
+	                              whitespace_state ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a byte stream for the first byte that differs in whitespace class from the preceding byte
+ * The whitespace state is 1 if the byte preceding the byte stream is whitespace
+ * or 0 if not, and is updated to the class of the returned byte
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+size_t libcsplit_simd_search_whitespace_transition(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        uint8_t *whitespace_state )
+{
+	if( ( byte_stream == NULL )
+	 || ( whitespace_state == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 64 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_whitespace_transition_avx2(
+			         byte_stream,
+			         byte_stream_size,
+			         whitespace_state ) );
+		}
+		if( __builtin_cpu_supports( "sse2" ) )
+		{
+			return( libcsplit_simd_search_whitespace_transition_sse2(
+			         byte_stream,
+			         byte_stream_size,
+			         whitespace_state ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_whitespace_transition_scalar(
+	         byte_stream,
+	         byte_stream_size,
+	         whitespace_state ) );
+}
+
+/* Searches a byte stream for the first byte with a non-zero byte class one byte at a time
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+static size_t libcsplit_simd_search_byte_class_scalar(
+               const uint8_t *byte_stream,
+               const uint8_t *low_nibble_classes,
+               const uint8_t *high_nibble_classes,
+               size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < byte_stream_size;
+	     byte_stream_offset++ )
+	{
+		if( LIBCSPLIT_SIMD_GET_BYTE_CLASS(
+		     low_nibble_classes,
+		     high_nibble_classes,
+		     byte_stream[ byte_stream_offset ] ) != 0 )
+		{
+			break;
+		}
+	}
+	return( byte_stream_offset );
+}
+
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+
+/* Searches a byte stream for the first byte with a non-zero byte class 16 bytes at a time using SSSE3
+ * The classes of both nibbles of every byte are looked up with a byte shuffle
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+__attribute__((target("ssse3")))
+static size_t libcsplit_simd_search_byte_class_ssse3(
+               const uint8_t *byte_stream,
+               const uint8_t *low_nibble_classes,
+               const uint8_t *high_nibble_classes,
+               size_t byte_stream_size )
+{
+	__m128i high_nibble_table = _mm_loadu_si128(
+	                             (const __m128i *) high_nibble_classes );
+	__m128i low_nibble_table  = _mm_loadu_si128(
+	                             (const __m128i *) low_nibble_classes );
+	__m128i nibble_mask       = _mm_set1_epi8( 0x0f );
+	__m128i zero_bytes        = _mm_setzero_si128();
+	__m128i bytes             = _mm_setzero_si128();
+	__m128i classes           = _mm_setzero_si128();
+	size_t byte_stream_offset = 0;
+	int mask                  = 0;
+
+	while( ( byte_stream_offset + 16 ) <= byte_stream_size )
+	{
+		bytes = _mm_loadu_si128(
+		         (const __m128i *) &( byte_stream[ byte_stream_offset ] ) );
+
+		classes = _mm_and_si128(
+		           _mm_shuffle_epi8(
+		            low_nibble_table,
+		            _mm_and_si128(
+		             bytes,
+		             nibble_mask ) ),
+		           _mm_shuffle_epi8(
+		            high_nibble_table,
+		            _mm_and_si128(
+		             _mm_srli_epi16(
+		              bytes,
+		              4 ),
+		             nibble_mask ) ) );
+
+		mask = _mm_movemask_epi8(
+		        _mm_cmpeq_epi8(
+		         classes,
+		         zero_bytes ) ) ^ 0xffff;
+
+		if( mask != 0 )
+		{
+			return( byte_stream_offset + __builtin_ctz( (unsigned int) mask ) );
+		}
+		byte_stream_offset += 16;
+	}
+	return( byte_stream_offset + libcsplit_simd_search_byte_class_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              low_nibble_classes,
+	                              high_nibble_classes,
+	                              byte_stream_size - byte_stream_offset ) );
+}
+
+/* Searches a byte stream for the first byte with a non-zero byte class 32 bytes at a time using AVX2
+ * The classes of both nibbles of every byte are looked up with a byte shuffle,
+ * that operates per 128-bit lane hence the tables are repeated in both lanes
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libcsplit_simd_search_byte_class_avx2(
+               const uint8_t *byte_stream,
+               const uint8_t *low_nibble_classes,
+               const uint8_t *high_nibble_classes,
+               size_t byte_stream_size )
+{
+	__m256i high_nibble_table = _mm256_broadcastsi128_si256(
+	                             _mm_loadu_si128(
+	                              (const __m128i *) high_nibble_classes ) );
+	__m256i low_nibble_table  = _mm256_broadcastsi128_si256(
+	                             _mm_loadu_si128(
+	                              (const __m128i *) low_nibble_classes ) );
+	__m256i nibble_mask       = _mm256_set1_epi8( 0x0f );
+	__m256i zero_bytes        = _mm256_setzero_si256();
+	__m256i bytes             = _mm256_setzero_si256();
+	__m256i classes           = _mm256_setzero_si256();
+	size_t byte_stream_offset = 0;
+	uint32_t mask             = 0;
+
+	while( ( byte_stream_offset + 32 ) <= byte_stream_size )
+	{
+		bytes = _mm256_loadu_si256(
+		         (const __m256i *) &( byte_stream[ byte_stream_offset ] ) );
+
+		classes = _mm256_and_si256(
+		           _mm256_shuffle_epi8(
+		            low_nibble_table,
+		            _mm256_and_si256(
+		             bytes,
+		             nibble_mask ) ),
+		           _mm256_shuffle_epi8(
+		            high_nibble_table,
+		            _mm256_and_si256(
+		             _mm256_srli_epi16(
+		              bytes,
+		              4 ),
+		             nibble_mask ) ) );
+
+		mask = ~( (uint32_t) _mm256_movemask_epi8(
+		                      _mm256_cmpeq_epi8(
+		                       classes,
+		                       zero_bytes ) ) );
+
+		if( mask != 0 )
+		{
+			return( byte_stream_offset + __builtin_ctz( mask ) );
+		}
+		byte_stream_offset += 32;
+	}
+	return( byte_stream_offset + libcsplit_simd_search_byte_class_scalar(
+	                              &( byte_stream[ byte_stream_offset ] ),
+	                              low_nibble_classes,
+	                              high_nibble_classes,
+	                              byte_stream_size - byte_stream_offset ) );
+}
+
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+/* Searches a byte stream for the first byte with a non-zero byte class
+ * The class of a byte is the bitwise AND of the class of its low nibble and the
+ * class of its high nibble, both tables contain 16 classes. If every bit of
+ * the classes is assigned to a single byte value, the class identifies the byte
+ * The kernel is selected at runtime based on the features supported by the CPU
+ * Returns the offset of the byte or byte_stream_size if not found
+ */
+size_t libcsplit_simd_search_byte_class(
+        const uint8_t *byte_stream,
+        const uint8_t *low_nibble_classes,
+        const uint8_t *high_nibble_classes,
+        size_t byte_stream_size )
+{
+	if( ( byte_stream == NULL )
+	 || ( low_nibble_classes == NULL )
+	 || ( high_nibble_classes == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS )
+	if( byte_stream_size >= 16 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			return( libcsplit_simd_search_byte_class_avx2(
+			         byte_stream,
+			         low_nibble_classes,
+			         high_nibble_classes,
+			         byte_stream_size ) );
+		}
+		if( __builtin_cpu_supports( "ssse3" ) )
+		{
+			return( libcsplit_simd_search_byte_class_ssse3(
+			         byte_stream,
+			         low_nibble_classes,
+			         high_nibble_classes,
+			         byte_stream_size ) );
+		}
+	}
+#endif /* defined( LIBCSPLIT_SIMD_HAVE_X86_KERNELS ) */
+
+	return( libcsplit_simd_search_byte_class_scalar(
+	         byte_stream,
+	         low_nibble_classes,
+	         high_nibble_classes,
+	         byte_stream_size ) );
+}
@@ -0,0 +1,109 @@
+/*
+ * SIMD code unit search functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_SIMD_H )
+#define _LIBCSPLIT_SIMD_H
+
+#include <common.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The x86 kernels rely on the GCC and Clang target attribute and CPU detection built-ins
+ */
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBCSPLIT_SIMD_HAVE_X86_KERNELS	1
+#endif
+
+/* Determines the class of a byte from the classes of its nibbles
+ */
+#define LIBCSPLIT_SIMD_GET_BYTE_CLASS( low_nibble_classes, high_nibble_classes, byte ) \
+	( ( low_nibble_classes )[ ( byte ) & 0x0f ] & ( high_nibble_classes )[ ( ( byte ) >> 4 ) & 0x0f ] )
+
+const uint16_t *libcsplit_simd_search_uint16(
+                 const uint16_t *string,
+                 uint16_t code_unit,
+                 size_t string_length );
+
+const uint32_t *libcsplit_simd_search_uint32(
+                 const uint32_t *string,
+                 uint32_t code_unit,
+                 size_t string_length );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+const wchar_t *libcsplit_simd_search_wide(
+               const wchar_t *string,
+               wchar_t code_unit,
+               size_t string_length );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+const uint8_t *libcsplit_simd_search_uint16_little_endian(
+                const uint8_t *byte_stream,
+                uint16_t code_unit,
+                size_t byte_stream_size );
+
+const uint16_t *libcsplit_simd_search_uint16_pair(
+                 const uint16_t *string,
+                 uint16_t first_code_unit,
+                 uint16_t second_code_unit,
+                 size_t string_length );
+
+size_t libcsplit_simd_span_ascii(
+        const uint8_t *byte_stream,
+        uint8_t stop_byte,
+        size_t byte_stream_size );
+
+size_t libcsplit_simd_search_unquoted(
+        const uint8_t *byte_stream,
+        uint8_t delimiter,
+        uint8_t quote,
+        size_t byte_stream_size,
+        uint8_t *quote_state );
+
+size_t libcsplit_simd_search_unescaped(
+        const uint8_t *byte_stream,
+        uint8_t delimiter,
+        uint8_t escape,
+        size_t byte_stream_size,
+        uint8_t *escape_state );
+
+size_t libcsplit_simd_search_whitespace_transition(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size,
+        uint8_t *whitespace_state );
+
+size_t libcsplit_simd_search_byte_class(
+        const uint8_t *byte_stream,
+        const uint8_t *low_nibble_classes,
+        const uint8_t *high_nibble_classes,
+        size_t byte_stream_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_SIMD_H ) */
+
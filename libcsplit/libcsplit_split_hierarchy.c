@@ -0,0 +1,584 @@
+/*
+ * Split hierarchy functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_split_hierarchy.h"
+#include "libcsplit_types.h"
+
+/* Creates a split hierarchy
+ * Make sure the value split_hierarchy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_initialize(
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     int number_of_levels,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_initialize";
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_hierarchy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split hierarchy value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_levels <= 0 )
+	 || ( number_of_levels > LIBCSPLIT_SPLIT_HIERARCHY_MAXIMUM_NUMBER_OF_LEVELS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of levels value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = memory_allocate_structure(
+	                            libcsplit_internal_split_hierarchy_t );
+
+	if( internal_split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_split_hierarchy,
+	     0,
+	     sizeof( libcsplit_internal_split_hierarchy_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear split hierarchy.",
+		 function );
+
+		memory_free(
+		 internal_split_hierarchy );
+
+		return( -1 );
+	}
+	internal_split_hierarchy->number_of_levels = number_of_levels;
+
+	*split_hierarchy = (libcsplit_split_hierarchy_t *) internal_split_hierarchy;
+
+	return( 1 );
+}
+
+/* Frees a split hierarchy
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_free(
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	libcsplit_split_hierarchy_level_t *split_hierarchy_level       = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_free";
+	int level                                                      = 0;
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_hierarchy != NULL )
+	{
+		internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) *split_hierarchy;
+		*split_hierarchy         = NULL;
+
+		for( level = 0;
+		     level < internal_split_hierarchy->number_of_levels;
+		     level++ )
+		{
+			split_hierarchy_level = &( internal_split_hierarchy->levels[ level ] );
+
+			if( split_hierarchy_level->segment_offsets != NULL )
+			{
+				memory_free(
+				 split_hierarchy_level->segment_offsets );
+			}
+			if( split_hierarchy_level->segment_sizes != NULL )
+			{
+				memory_free(
+				 split_hierarchy_level->segment_sizes );
+			}
+			if( split_hierarchy_level->children_end_indexes != NULL )
+			{
+				memory_free(
+				 split_hierarchy_level->children_end_indexes );
+			}
+		}
+		memory_free(
+		 internal_split_hierarchy );
+	}
+	return( 1 );
+}
+
+/* Appends a segment to a specific level
+ * The child segments of the segment are the segments that were appended to
+ * the next level since the preceding segment of the level was appended,
+ * hence the segments of a deeper level must be appended first
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_append_segment(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     size_t segment_offset,
+     size_t segment_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	libcsplit_split_hierarchy_level_t *split_hierarchy_level       = NULL;
+	int *reallocated_children_end_indexes                          = NULL;
+	size_t *reallocated_segment_offsets                            = NULL;
+	size_t *reallocated_segment_sizes                              = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_append_segment";
+	int number_of_segments                                         = 0;
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) split_hierarchy;
+
+	if( ( level < 0 )
+	 || ( level >= internal_split_hierarchy->number_of_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_offset > (size_t) SSIZE_MAX )
+	 || ( segment_size > ( (size_t) SSIZE_MAX - segment_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment offset or size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	split_hierarchy_level = &( internal_split_hierarchy->levels[ level ] );
+
+	if( split_hierarchy_level->number_of_segments >= split_hierarchy_level->maximum_number_of_segments )
+	{
+		if( split_hierarchy_level->maximum_number_of_segments == 0 )
+		{
+			number_of_segments = 16;
+		}
+		else if( split_hierarchy_level->maximum_number_of_segments > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_segments = split_hierarchy_level->maximum_number_of_segments * 2;
+		}
+		reallocated_segment_offsets = (size_t *) memory_reallocate(
+		                                          split_hierarchy_level->segment_offsets,
+		                                          sizeof( size_t ) * number_of_segments );
+
+		if( reallocated_segment_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment offsets.",
+			 function );
+
+			return( -1 );
+		}
+		split_hierarchy_level->segment_offsets = reallocated_segment_offsets;
+
+		reallocated_segment_sizes = (size_t *) memory_reallocate(
+		                                        split_hierarchy_level->segment_sizes,
+		                                        sizeof( size_t ) * number_of_segments );
+
+		if( reallocated_segment_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment sizes.",
+			 function );
+
+			return( -1 );
+		}
+		split_hierarchy_level->segment_sizes = reallocated_segment_sizes;
+
+		if( ( level + 1 ) < internal_split_hierarchy->number_of_levels )
+		{
+			reallocated_children_end_indexes = (int *) memory_reallocate(
+			                                            split_hierarchy_level->children_end_indexes,
+			                                            sizeof( int ) * number_of_segments );
+
+			if( reallocated_children_end_indexes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize children end indexes.",
+				 function );
+
+				return( -1 );
+			}
+			split_hierarchy_level->children_end_indexes = reallocated_children_end_indexes;
+		}
+		split_hierarchy_level->maximum_number_of_segments = number_of_segments;
+	}
+	number_of_segments = split_hierarchy_level->number_of_segments;
+
+	split_hierarchy_level->segment_offsets[ number_of_segments ] = segment_offset;
+	split_hierarchy_level->segment_sizes[ number_of_segments ]   = segment_size;
+
+	if( ( level + 1 ) < internal_split_hierarchy->number_of_levels )
+	{
+		split_hierarchy_level->children_end_indexes[ number_of_segments ] = internal_split_hierarchy->levels[ level + 1 ].number_of_segments;
+	}
+	split_hierarchy_level->number_of_segments += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of levels
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_get_number_of_levels(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int *number_of_levels,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_get_number_of_levels";
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) split_hierarchy;
+
+	if( number_of_levels == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of levels.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_levels = internal_split_hierarchy->number_of_levels;
+
+	return( 1 );
+}
+
+/* Retrieves the number of segments of a specific level
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_get_number_of_segments(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_get_number_of_segments";
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) split_hierarchy;
+
+	if( ( level < 0 )
+	 || ( level >= internal_split_hierarchy->number_of_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = internal_split_hierarchy->levels[ level ].number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves the offset and size of a specific segment of a specific level
+ * The offset and size are relative to the string that was split
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_get_segment_by_index(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int segment_index,
+     size_t *segment_offset,
+     size_t *segment_size,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	libcsplit_split_hierarchy_level_t *split_hierarchy_level       = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_get_segment_by_index";
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) split_hierarchy;
+
+	if( ( level < 0 )
+	 || ( level >= internal_split_hierarchy->number_of_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	split_hierarchy_level = &( internal_split_hierarchy->levels[ level ] );
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= split_hierarchy_level->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_offset = split_hierarchy_level->segment_offsets[ segment_index ];
+	*segment_size   = split_hierarchy_level->segment_sizes[ segment_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the child segments of a specific segment of a specific level
+ * The child segments are the consecutive segments of the next level, that
+ * start at the first child segment index. The last level has no next level
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_split_hierarchy_get_child_segments(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int segment_index,
+     int *first_child_segment_index,
+     int *number_of_child_segments,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_split_hierarchy_t *internal_split_hierarchy = NULL;
+	libcsplit_split_hierarchy_level_t *split_hierarchy_level       = NULL;
+	static char *function                                          = "libcsplit_split_hierarchy_get_child_segments";
+	int children_start_index                                       = 0;
+
+	if( split_hierarchy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split hierarchy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_hierarchy = (libcsplit_internal_split_hierarchy_t *) split_hierarchy;
+
+	if( ( level < 0 )
+	 || ( level >= ( internal_split_hierarchy->number_of_levels - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	split_hierarchy_level = &( internal_split_hierarchy->levels[ level ] );
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= split_hierarchy_level->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_child_segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first child segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_child_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of child segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index > 0 )
+	{
+		children_start_index = split_hierarchy_level->children_end_indexes[ segment_index - 1 ];
+	}
+	*first_child_segment_index = children_start_index;
+	*number_of_child_segments  = split_hierarchy_level->children_end_indexes[ segment_index ] - children_start_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,132 @@
+/*
+ * Split hierarchy functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_INTERNAL_SPLIT_HIERARCHY_H )
+#define _LIBCSPLIT_INTERNAL_SPLIT_HIERARCHY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of levels, one per bit of a byte class
+ */
+#define LIBCSPLIT_SPLIT_HIERARCHY_MAXIMUM_NUMBER_OF_LEVELS	8
+
+typedef struct libcsplit_split_hierarchy_level libcsplit_split_hierarchy_level_t;
+
+struct libcsplit_split_hierarchy_level
+{
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The maximum number of segments
+	 */
+	int maximum_number_of_segments;
+
+	/* The segment offsets
+	 */
+	size_t *segment_offsets;
+
+	/* The segment sizes
+	 */
+	size_t *segment_sizes;
+
+	/* The index of the segment that follows the last child segment
+	 * in the next level, per segment
+	 */
+	int *children_end_indexes;
+};
+
+typedef struct libcsplit_internal_split_hierarchy libcsplit_internal_split_hierarchy_t;
+
+struct libcsplit_internal_split_hierarchy
+{
+	/* The number of levels
+	 */
+	int number_of_levels;
+
+	/* The levels
+	 */
+	libcsplit_split_hierarchy_level_t levels[ LIBCSPLIT_SPLIT_HIERARCHY_MAXIMUM_NUMBER_OF_LEVELS ];
+};
+
+int libcsplit_split_hierarchy_initialize(
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     int number_of_levels,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_split_hierarchy_free(
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     libcerror_error_t **error );
+
+int libcsplit_split_hierarchy_append_segment(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     size_t segment_offset,
+     size_t segment_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_split_hierarchy_get_number_of_levels(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int *number_of_levels,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_split_hierarchy_get_number_of_segments(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_split_hierarchy_get_segment_by_index(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int segment_index,
+     size_t *segment_offset,
+     size_t *segment_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_split_hierarchy_get_child_segments(
+     libcsplit_split_hierarchy_t *split_hierarchy,
+     int level,
+     int segment_index,
+     int *first_child_segment_index,
+     int *number_of_child_segments,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_INTERNAL_SPLIT_HIERARCHY_H ) */
+
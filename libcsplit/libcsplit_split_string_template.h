@@ -0,0 +1,834 @@
+/*
+ * Split string functions template
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file is a template that is included by the split string source files
+ * once for every code unit type, hence it has no include guard. Before it is
+ * included the following must be defined:
+ *   LIBCSPLIT_TEMPLATE_CHARACTER_T                      the code unit type
+ *   LIBCSPLIT_TEMPLATE_SPLIT_STRING_T                   the split string type
+ *   LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T          the internal split string type
+ *   LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )      the function identifier
+ *   LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( name ) the function name string
+ * The definitions are undefined at the end of the template
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_definitions.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+
+/* Creates a split string
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( initialize )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "initialize" );
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segments less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = memory_allocate_structure(
+			         LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T );
+
+	if( internal_split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create split string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_split_string,
+	     0,
+	     sizeof( LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear split string.",
+		 function );
+
+		memory_free(
+		 internal_split_string );
+
+		return( -1 );
+	}
+	if( ( string != NULL )
+	 && ( string_size > 0 ) )
+	{
+		internal_split_string->string = (LIBCSPLIT_TEMPLATE_CHARACTER_T *) memory_allocate(
+		                                 sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T ) * string_size );
+
+		if( internal_split_string->string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_split_string->string,
+		     string,
+		     sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T ) * ( string_size - 1 ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		internal_split_string->string[ string_size - 1 ] = 0;
+		internal_split_string->string_size               = string_size;
+	}
+	if( number_of_segments > 0 )
+	{
+		internal_split_string->segments = (LIBCSPLIT_TEMPLATE_CHARACTER_T **) memory_allocate(
+		                                             sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T * ) * number_of_segments );
+
+		if( internal_split_string->segments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segments.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_split_string->segments,
+		     0,
+		     sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T * ) * number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segments.",
+			 function );
+
+			goto on_error;
+		}
+		internal_split_string->segment_sizes = (size_t *) memory_allocate(
+		                                                   sizeof( size_t ) * number_of_segments );
+
+		if( internal_split_string->segment_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create segment sizes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_split_string->segment_sizes,
+		     0,
+		     sizeof( size_t ) * number_of_segments ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_split_string->number_of_segments = number_of_segments;
+
+	*split_string = (LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *) internal_split_string;
+
+	return( 1 );
+
+on_error:
+	if( internal_split_string != NULL )
+	{
+		if( internal_split_string->segment_sizes != NULL )
+		{
+			memory_free(
+			 internal_split_string->segment_sizes );
+		}
+		if( internal_split_string->segments != NULL )
+		{
+			memory_free(
+			 internal_split_string->segments );
+		}
+		if( internal_split_string->string != NULL )
+		{
+			memory_free(
+			 internal_split_string->string );
+		}
+		memory_free(
+		 internal_split_string );
+	}
+	return( -1 );
+}
+
+/* Frees a split string
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "free" );
+	int result                                                        = 1;
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) *split_string;
+		*split_string         = NULL;
+
+		/* The string of a mapped file references the mapped data
+		 */
+		if( internal_split_string->mapped_file != NULL )
+		{
+			if( libcsplit_mapped_file_free(
+			     &( internal_split_string->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( internal_split_string->string != NULL )
+		{
+			memory_free(
+			 internal_split_string->string );
+		}
+		if( internal_split_string->segments != NULL )
+		{
+			memory_free(
+			 internal_split_string->segments );
+		}
+		if( internal_split_string->segment_sizes != NULL )
+		{
+			memory_free(
+			 internal_split_string->segment_sizes );
+		}
+		memory_free(
+		 internal_split_string );
+	}
+	return( result );
+}
+
+/* Retrieves the string
+ * The string contains the segments with the delimiters replaced by end-of-string characters,
+ * unless the LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED flag is set, in which case the string
+ * references the original data and the delimiters are retained
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_string )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "get_string" );
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string      = internal_split_string->string;
+	*string_size = internal_split_string->string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * The flags are a combination of the LIBCSPLIT_SPLIT_STRING_FLAGS values,
+ * LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED indicates the segments are not terminated
+ * by an end-of-string character and their sizes exclude it and
+ * LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY indicates the string and segments must not be modified
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_flags )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "get_flags" );
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_split_string->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of segments
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_number_of_segments )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "get_number_of_segments" );
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = internal_split_string->number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves a specific segment
+ * The segment is terminated by an end-of-string character that is included in its size,
+ * unless the LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED flag is set, in which case the segment
+ * is not terminated and its size excludes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_segment_by_index )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     int segment_index,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T **string_segment,
+     size_t *string_segment_size,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "get_segment_by_index" );
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= internal_split_string->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string segment size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_segment      = internal_split_string->segments[ segment_index ];
+	*string_segment_size = internal_split_string->segment_sizes[ segment_index ];
+
+	return( 1 );
+}
+
+/* Sets a specific segment
+ * The segment size must include the end-of-string character, unless
+ * the LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED flag is set
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( set_segment_by_index )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     int segment_index,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T *string_segment,
+     size_t string_segment_size,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "set_segment_by_index" );
+	size_t string_segment_offset                                      = 0;
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( ( segment_index < 0 )
+	 || ( segment_index >= internal_split_string->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_segment_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_segment == NULL )
+	{
+		if( string_segment_size != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( string_segment < internal_split_string->string )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		string_segment_offset = (size_t) ( string_segment - internal_split_string->string );
+
+		if( string_segment_offset >= internal_split_string->string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		string_segment_offset += string_segment_size;
+
+		if( string_segment_offset > internal_split_string->string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string segment value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_split_string->segments[ segment_index ]      = string_segment;
+	internal_split_string->segment_sizes[ segment_index ] = string_segment_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the joined string
+ * The joined string consists of the segments separated by a delimiter and
+ * an end-of-string character, hence the size does not depend on the delimiter
+ * The size is the same for terminated and unterminated segments, refer to
+ * the LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED flag
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_joined_string_size )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     size_t *joined_string_size,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "get_joined_string_size" );
+	size_t safe_joined_string_size                                    = 1;
+	size_t string_segment_size                                        = 0;
+	int segment_index                                                 = 0;
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( joined_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid joined string size.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
+	{
+		string_segment_size = internal_split_string->segment_sizes[ segment_index ];
+
+		/* The size of a segment includes the end-of-string character
+		 * which is replaced by the delimiter, except for the last segment
+		 */
+		if( ( ( internal_split_string->flags & LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED ) != 0 )
+		 || ( string_segment_size == 0 ) )
+		{
+			string_segment_size += 1;
+		}
+		if( string_segment_size > ( (size_t) SSIZE_MAX - safe_joined_string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid joined string size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_joined_string_size += string_segment_size;
+	}
+	/* The last segment is not followed by a delimiter
+	 */
+	if( internal_split_string->number_of_segments > 0 )
+	{
+		safe_joined_string_size -= 1;
+	}
+	*joined_string_size = safe_joined_string_size;
+
+	return( 1 );
+}
+
+/* Joins the segments into a string separated by the delimiter
+ * The string must be at least the size determined by
+ * the get joined string size function and is terminated
+ * by an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( join )(
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T *split_string,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T delimiter,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( "join" );
+	size_t joined_string_size                                         = 0;
+	size_t string_index                                               = 0;
+	size_t string_segment_size                                        = 0;
+	int segment_index                                                 = 0;
+
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) split_string;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( get_joined_string_size )(
+	     split_string,
+	     &joined_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve joined string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < joined_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
+	{
+		string_segment_size = internal_split_string->segment_sizes[ segment_index ];
+
+		if( ( ( internal_split_string->flags & LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED ) == 0 )
+		 && ( string_segment_size > 0 ) )
+		{
+			string_segment_size -= 1;
+		}
+		if( string_segment_size > 0 )
+		{
+			if( memory_copy(
+			     &( string[ string_index ] ),
+			     internal_split_string->segments[ segment_index ],
+			     sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T ) * string_segment_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy segment: %d.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+			string_index += string_segment_size;
+		}
+		if( ( segment_index + 1 ) < internal_split_string->number_of_segments )
+		{
+			string[ string_index++ ] = delimiter;
+		}
+	}
+	string[ string_index ] = 0;
+
+	return( 1 );
+}
+
+#undef LIBCSPLIT_TEMPLATE_CHARACTER_T
+#undef LIBCSPLIT_TEMPLATE_SPLIT_STRING_T
+#undef LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T
+#undef LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION
+#undef LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME
+
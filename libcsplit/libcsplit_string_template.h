@@ -0,0 +1,1455 @@
+/*
+ * String functions template
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file is a template that is included by the string source files
+ * once for every code unit type, hence it has no include guard. Before it is
+ * included the following must be defined:
+ *   LIBCSPLIT_TEMPLATE_CHARACTER_T                      the code unit type
+ *   LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit )       the code unit as an unsigned value
+ *   LIBCSPLIT_TEMPLATE_SPLIT_STRING_T                   the split string type
+ *   LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T          the internal split string type
+ *   LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )      the split string function identifier
+ *   LIBCSPLIT_TEMPLATE_STRING_FUNCTION( name )            the string function identifier
+ *   LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( name )       the string function name string
+ * Optionally LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) can be
+ * defined to search for a single code unit, such as memchr, otherwise the code units
+ * are compared one by one
+ * The definitions are undefined at the end of the template
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_definitions.h"
+#include "libcsplit_delimiter_table.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_segment_table.h"
+
+/* Searches a string for a specific code unit
+ * Returns the index of the code unit or string_length if not found
+ */
+static size_t LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+               const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+               size_t string_length,
+               LIBCSPLIT_TEMPLATE_CHARACTER_T code_unit )
+{
+#if defined( LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT )
+	const LIBCSPLIT_TEMPLATE_CHARACTER_T *match = NULL;
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	match = LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT(
+	         string,
+	         code_unit,
+	         string_length );
+
+	if( match == NULL )
+	{
+		return( string_length );
+	}
+	return( (size_t) ( match - string ) );
+#else
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] == code_unit )
+		{
+			break;
+		}
+	}
+	return( string_index );
+#endif
+}
+
+/* Determines if a code unit is a delimiter
+ * Returns 1 if the code unit is a delimiter or 0 if not
+ */
+static int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( is_delimiter )(
+            libcsplit_delimiter_table_t *delimiter_table,
+            LIBCSPLIT_TEMPLATE_CHARACTER_T code_unit )
+{
+	uint32_t code_unit_value = LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit );
+
+	if( code_unit_value < 256 )
+	{
+		return( (int) delimiter_table->is_delimiter[ code_unit_value ] );
+	}
+	return( libcsplit_delimiter_table_is_delimiter(
+	         delimiter_table,
+	         code_unit_value ) );
+}
+
+/* Searches a string for the first delimiter
+ * A single delimiter is searched for as a code unit, a set of delimiters is classified by the table
+ * Returns the index of the first delimiter or string_length if not found
+ */
+static size_t LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_delimiter )(
+               libcsplit_delimiter_table_t *delimiter_table,
+               const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+               size_t string_length )
+{
+	size_t string_index = 0;
+
+	if( delimiter_table->number_of_delimiters == 1 )
+	{
+		return( LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		         string,
+		         string_length,
+		         (LIBCSPLIT_TEMPLATE_CHARACTER_T) delimiter_table->first_delimiter ) );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( LIBCSPLIT_TEMPLATE_STRING_FUNCTION( is_delimiter )(
+		     delimiter_table,
+		     string[ string_index ] ) != 0 )
+		{
+			break;
+		}
+	}
+	return( string_index );
+}
+
+/* Splits a string
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( split )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T delimiter,
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	LIBCSPLIT_TEMPLATE_CHARACTER_T *string_copy                       = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "split" );
+	size_t segment_length                                             = 0;
+	size_t string_index                                               = 0;
+	size_t string_length                                              = 0;
+	int number_of_segments                                            = 0;
+	int segment_index                                                 = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	/* Determine the number of segments
+	 */
+	number_of_segments = 1;
+
+	while( string_index < string_length )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string[ string_index ] ),
+		                  string_length - string_index,
+		                  delimiter );
+
+		string_index += segment_length;
+
+		if( string_index >= string_length )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		string_index++;
+	}
+	if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( initialize )(
+	     split_string,
+	     string,
+	     string_size,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) *split_string;
+
+	/* Determine the segments
+	 * the segments are terminated in the copy of the string,
+	 * empty segments are stored as strings only containing the end of character
+	 * the last segment runs up to the last character of the string, including
+	 * the characters after an end-of-string character
+	 */
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_index == ( number_of_segments - 1 ) )
+		{
+			segment_length = ( string_size - 1 ) - string_index;
+		}
+		else
+		{
+			segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+			                  &( string_copy[ string_index ] ),
+			                  string_length - string_index,
+			                  delimiter );
+		}
+
+		string_copy[ string_index + segment_length ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ string_index ] );
+		internal_split_string->segment_sizes[ segment_index ] = segment_length + 1;
+
+		string_index += segment_length + 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a string of which the extent is defined by the string size
+ * The string is not terminated and can contain end-of-string characters,
+ * such as binary or length-delimited data, hence only the delimiter is
+ * compared. The segment offsets and sizes are in code units relative to
+ * the start of the string and exclude the delimiter
+ * Make sure the value segment_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( split_binary )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T delimiter,
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error )
+{
+	static char *function  = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "split_binary" );
+	size_t segment_length  = 0;
+	size_t string_index    = 0;
+	int number_of_segments = 0;
+	int segment_index      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment table already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( string_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the number of segments
+	 */
+	number_of_segments = 1;
+
+	while( string_index < string_size )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string[ string_index ] ),
+		                  string_size - string_index,
+		                  delimiter );
+
+		string_index += segment_length;
+
+		if( string_index >= string_size )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		string_index++;
+	}
+	if( libcsplit_segment_table_initialize(
+	     segment_table,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize segment table.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the segments
+	 */
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string[ string_index ] ),
+		                  string_size - string_index,
+		                  delimiter );
+
+		if( libcsplit_segment_table_set_segment_by_index(
+		     *segment_table,
+		     segment_index,
+		     string_index,
+		     segment_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		string_index += segment_length + 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *segment_table != NULL )
+	{
+		libcsplit_segment_table_free(
+		 segment_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a multi-string
+ * A multi-string consists of strings separated by the end-of-string character
+ * and is terminated by an empty string, such as a REG_MULTI_SZ value. The
+ * multi-string ends at the first empty string or the last character
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( split_multi_string )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	LIBCSPLIT_TEMPLATE_CHARACTER_T *string_copy                       = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "split_multi_string" );
+	size_t segment_length                                             = 0;
+	size_t string_index                                               = 0;
+	size_t string_length                                              = 0;
+	int number_of_segments                                            = 0;
+	int segment_index                                                 = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty multi-string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	string_length = string_size - 1;
+
+	/* Determine the number of strings, the last string does not need to be terminated
+	 */
+	while( string_index < string_length )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string[ string_index ] ),
+		                  string_length - string_index,
+		                  0 );
+
+		if( segment_length == 0 )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		string_index += segment_length + 1;
+	}
+	/* A multi-string that only consists of its last character has no segments
+	 */
+	if( number_of_segments == 0 )
+	{
+		return( 1 );
+	}
+	if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( initialize )(
+	     split_string,
+	     string,
+	     string_size,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) *split_string;
+
+	/* The strings are already terminated in the copy of the multi-string
+	 */
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string_copy[ string_index ] ),
+		                  string_length - string_index,
+		                  0 );
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ string_index ] );
+		internal_split_string->segment_sizes[ segment_index ] = segment_length + 1;
+
+		string_index += segment_length + 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits a path into normalized path components
+ * Both '/' and '\' are treated as path separators. Empty and "." components
+ * are removed and ".." components are resolved against the preceding component
+ * in the same pass. An absolute path starts with an empty segment and a leading
+ * component ending with ':', such as a drive letter, is treated as a root.
+ * A path that starts with 2 separators is an UNC path of which the server and
+ * share name components are part of the root and are not removed by "..".
+ * ".." components that cannot be resolved are kept for a relative path and
+ * removed for an absolute path. A path of which no components remain has no
+ * segments
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( split_path )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *path,
+     size_t path_size,
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     libcerror_error_t **error )
+{
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	LIBCSPLIT_TEMPLATE_CHARACTER_T *string                            = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "split_path" );
+	size_t component_length                                           = 0;
+	size_t component_start                                            = 0;
+	size_t path_length                                                = 0;
+	size_t string_index                                               = 0;
+	int maximum_number_of_segments                                    = 0;
+	int number_of_root_segments                                       = 0;
+	int number_of_unc_segments                                        = 0;
+	int segment_index                                                 = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty path has no segments
+	 */
+	if( ( path_size == 0 )
+	 || ( path[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The path ends at the first end of string character or the last character
+	 */
+	path_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+	               path,
+	               path_size - 1,
+	               0 );
+	/* Every component consists of at least one character and a separator
+	 * the root segment is accounted for separately
+	 */
+	if( ( path_length / 2 ) > (size_t) ( INT_MAX - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_segments = (int) ( path_length / 2 ) + 2;
+
+	if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( initialize )(
+	     split_string,
+	     path,
+	     path_length + 1,
+	     maximum_number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) *split_string;
+
+	/* The components are terminated in the copy of the path
+	 */
+	string = internal_split_string->string;
+
+	if( ( string[ 0 ] == '/' )
+	 || ( string[ 0 ] == '\\' ) )
+	{
+		string[ 0 ] = 0;
+
+		internal_split_string->segments[ 0 ]      = string;
+		internal_split_string->segment_sizes[ 0 ] = 1;
+
+		number_of_root_segments = 1;
+		segment_index           = 1;
+		string_index            = 1;
+
+		/* The server and share name of an UNC path are part of the root
+		 */
+		if( ( path_length > 1 )
+		 && ( ( string[ 1 ] == '/' )
+		  ||  ( string[ 1 ] == '\\' ) ) )
+		{
+			number_of_unc_segments = 2;
+		}
+	}
+	while( string_index < path_length )
+	{
+		component_start = string_index;
+
+		while( string_index < path_length )
+		{
+			if( ( string[ string_index ] == '/' )
+			 || ( string[ string_index ] == '\\' ) )
+			{
+				break;
+			}
+			string_index++;
+		}
+		component_length = string_index - component_start;
+
+		string[ string_index ] = 0;
+
+		string_index++;
+
+		if( component_length == 0 )
+		{
+			continue;
+		}
+		if( ( component_length == 1 )
+		 && ( string[ component_start ] == '.' ) )
+		{
+			continue;
+		}
+		if( ( component_length == 2 )
+		 && ( string[ component_start ] == '.' )
+		 && ( string[ component_start + 1 ] == '.' ) )
+		{
+			if( segment_index > number_of_root_segments )
+			{
+				if( ( internal_split_string->segment_sizes[ segment_index - 1 ] != 3 )
+				 || ( internal_split_string->segments[ segment_index - 1 ][ 0 ] != '.' )
+				 || ( internal_split_string->segments[ segment_index - 1 ][ 1 ] != '.' ) )
+				{
+					segment_index--;
+
+					continue;
+				}
+			}
+			else if( number_of_root_segments > 0 )
+			{
+				continue;
+			}
+		}
+		else if( ( segment_index == 0 )
+		      && ( string[ string_index - 2 ] == ':' ) )
+		{
+			number_of_root_segments = 1;
+		}
+		else if( ( number_of_unc_segments > 0 )
+		      && ( segment_index <= number_of_unc_segments ) )
+		{
+			number_of_root_segments = segment_index + 1;
+		}
+		internal_split_string->segments[ segment_index ]      = &( string[ component_start ] );
+		internal_split_string->segment_sizes[ segment_index ] = component_length + 1;
+
+		segment_index++;
+	}
+	/* A path of which no components remain has no segments
+	 */
+	if( segment_index == 0 )
+	{
+		if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+		     split_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free split string.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	internal_split_string->number_of_segments = segment_index;
+
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the part of a segment that remains after trimming
+ * Returns the length of the trimmed segment, the index of its first code unit is stored in trim_index
+ */
+static size_t LIBCSPLIT_TEMPLATE_STRING_FUNCTION( trim_segment )(
+               libcsplit_delimiter_table_t *trim_table,
+               const LIBCSPLIT_TEMPLATE_CHARACTER_T *segment,
+               size_t segment_length,
+               size_t *trim_index )
+{
+	size_t segment_index = 0;
+
+	if( trim_table->number_of_delimiters != 0 )
+	{
+		while( ( segment_index < segment_length )
+		    && ( LIBCSPLIT_TEMPLATE_STRING_FUNCTION( is_delimiter )(
+		          trim_table,
+		          segment[ segment_index ] ) != 0 ) )
+		{
+			segment_index++;
+		}
+		while( ( segment_length > segment_index )
+		    && ( LIBCSPLIT_TEMPLATE_STRING_FUNCTION( is_delimiter )(
+		          trim_table,
+		          segment[ segment_length - 1 ] ) != 0 ) )
+		{
+			segment_length--;
+		}
+	}
+	*trim_index = segment_index;
+
+	return( segment_length - segment_index );
+}
+
+/* Splits a string with options that are applied while scanning
+ * The code units in trim_characters are removed from the start and end of every segment
+ * If LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY is set segments that are empty, after trimming, are not stored
+ * The number of segments is determined after trimming and skipping, hence the
+ * segments are stored without a separate pass to compact them
+ * A string of which all segments are skipped has no segments
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( split_with_options )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T delimiter,
+     uint8_t flags,
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *trim_characters,
+     size_t number_of_trim_characters,
+     LIBCSPLIT_TEMPLATE_SPLIT_STRING_T **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_delimiter_table_t trim_table;
+
+	LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *internal_split_string = NULL;
+	LIBCSPLIT_TEMPLATE_CHARACTER_T *string_copy                       = NULL;
+	static char *function                                             = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "split_with_options" );
+	size_t segment_length                                             = 0;
+	size_t string_index                                               = 0;
+	size_t string_length                                              = 0;
+	size_t trim_character_index                                       = 0;
+	size_t trim_index                                                 = 0;
+	size_t trimmed_segment_length                                     = 0;
+	uint8_t supported_flags                                           = 0;
+	int number_of_segments                                            = 0;
+	int segment_index                                                 = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( ( trim_characters == NULL )
+	 && ( number_of_trim_characters != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trim characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_trim_characters > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of trim characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_delimiter_table_clear(
+	     &trim_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear trim table.",
+		 function );
+
+		return( -1 );
+	}
+	for( trim_character_index = 0;
+	     trim_character_index < number_of_trim_characters;
+	     trim_character_index++ )
+	{
+		if( libcsplit_delimiter_table_add_delimiter(
+		     &trim_table,
+		     LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( trim_characters[ trim_character_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add trim character: %" PRIzu " to table.",
+			 function,
+			 trim_character_index );
+
+			return( -1 );
+		}
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+
+	/* Determine the number of segments that remain after trimming and skipping
+	 */
+	while( string_index <= string_length )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string[ string_index ] ),
+		                  string_length - string_index,
+		                  delimiter );
+
+		trimmed_segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( trim_segment )(
+		                          &trim_table,
+		                          &( string[ string_index ] ),
+		                          segment_length,
+		                          &trim_index );
+
+		if( ( trimmed_segment_length != 0 )
+		 || ( ( flags & LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY ) == 0 ) )
+		{
+			if( number_of_segments == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of segments value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_segments++;
+		}
+		string_index += segment_length + 1;
+	}
+	if( number_of_segments == 0 )
+	{
+		return( 1 );
+	}
+	if( LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( initialize )(
+	     split_string,
+	     string,
+	     string_size,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T *) *split_string;
+
+	/* Determine the segments
+	 * the trimmed segments are terminated in the copy of the string
+	 */
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	while( segment_index < number_of_segments )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+		                  &( string_copy[ string_index ] ),
+		                  string_length - string_index,
+		                  delimiter );
+
+		trimmed_segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( trim_segment )(
+		                          &trim_table,
+		                          &( string_copy[ string_index ] ),
+		                          segment_length,
+		                          &trim_index );
+
+		if( ( trimmed_segment_length != 0 )
+		 || ( ( flags & LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY ) == 0 ) )
+		{
+			string_copy[ string_index + trim_index + trimmed_segment_length ] = 0;
+
+			internal_split_string->segments[ segment_index ]      = &( string_copy[ string_index + trim_index ] );
+			internal_split_string->segment_sizes[ segment_index ] = trimmed_segment_length + 1;
+
+			segment_index++;
+		}
+		string_index += segment_length + 1;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( free )(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Transcodes the delimiters in a string
+ * Every code unit in delimiters is rewritten to the replacement delimiter
+ * If LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS is set a run of delimiters is rewritten to a single replacement delimiter
+ * If LIBCSPLIT_TRANSCODE_FLAG_STRIP is set leading and trailing delimiters are removed
+ * The transcoded string can be the same as the string to transcode the delimiters in place
+ * Returns 1 if successful or -1 on error
+ */
+int LIBCSPLIT_TEMPLATE_STRING_FUNCTION( transcode_delimiters )(
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *string,
+     size_t string_size,
+     const LIBCSPLIT_TEMPLATE_CHARACTER_T *delimiters,
+     size_t number_of_delimiters,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T replacement_delimiter,
+     uint8_t flags,
+     LIBCSPLIT_TEMPLATE_CHARACTER_T *transcoded_string,
+     size_t transcoded_string_size,
+     size_t *transcoded_string_length,
+     libcerror_error_t **error )
+{
+	libcsplit_delimiter_table_t delimiter_table;
+
+	static char *function           = LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( "transcode_delimiters" );
+	size_t delimiter_index          = 0;
+	size_t number_of_replacements   = 0;
+	size_t number_of_run_delimiters = 0;
+	size_t segment_index            = 0;
+	size_t segment_length           = 0;
+	size_t string_index             = 0;
+	size_t string_length            = 0;
+	size_t transcoded_string_index  = 0;
+	uint8_t supported_flags         = 0;
+	int has_segment                 = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS
+	                | LIBCSPLIT_TRANSCODE_FLAG_STRIP;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( transcoded_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoded string.",
+		 function );
+
+		return( -1 );
+	}
+	if( transcoded_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid transcoded string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( transcoded_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transcoded string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( delimiters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid delimiters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_delimiters == 0 )
+	 || ( number_of_delimiters > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of delimiters value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_delimiter_table_clear(
+	     &delimiter_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear delimiter table.",
+		 function );
+
+		return( -1 );
+	}
+	for( delimiter_index = 0;
+	     delimiter_index < number_of_delimiters;
+	     delimiter_index++ )
+	{
+		if( libcsplit_delimiter_table_add_delimiter(
+		     &delimiter_table,
+		     LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( delimiters[ delimiter_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add delimiter: %" PRIzu " to table.",
+			 function,
+			 delimiter_index );
+
+			return( -1 );
+		}
+	}
+	/* The string ends at the first end of string character or the last character
+	 */
+	string_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_code_unit )(
+	                 string,
+	                 string_size - 1,
+	                 0 );
+	/* The transcoded string is never longer than the string
+	 */
+	if( transcoded_string_size < ( string_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid transcoded string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < string_length )
+	{
+		segment_length = LIBCSPLIT_TEMPLATE_STRING_FUNCTION( search_delimiter )(
+		                  &delimiter_table,
+		                  &( string[ string_index ] ),
+		                  string_length - string_index );
+
+		if( segment_length > 0 )
+		{
+			if( ( has_segment != 0 )
+			 || ( ( flags & LIBCSPLIT_TRANSCODE_FLAG_STRIP ) == 0 ) )
+			{
+				number_of_replacements = number_of_run_delimiters;
+			}
+			else
+			{
+				number_of_replacements = 0;
+			}
+			if( ( ( flags & LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS ) != 0 )
+			 && ( number_of_replacements > 1 ) )
+			{
+				number_of_replacements = 1;
+			}
+			while( number_of_replacements > 0 )
+			{
+				transcoded_string[ transcoded_string_index++ ] = replacement_delimiter;
+
+				number_of_replacements--;
+			}
+			/* When transcoding in place the segment is moved towards the start of the string
+			 */
+			if( transcoded_string == string )
+			{
+				if( transcoded_string_index != string_index )
+				{
+					for( segment_index = 0;
+					     segment_index < segment_length;
+					     segment_index++ )
+					{
+						transcoded_string[ transcoded_string_index + segment_index ] = string[ string_index + segment_index ];
+					}
+				}
+			}
+			else if( memory_copy(
+			          &( transcoded_string[ transcoded_string_index ] ),
+			          &( string[ string_index ] ),
+			          sizeof( LIBCSPLIT_TEMPLATE_CHARACTER_T ) * segment_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy segment.",
+				 function );
+
+				return( -1 );
+			}
+			transcoded_string_index += segment_length;
+			string_index            += segment_length;
+
+			number_of_run_delimiters = 0;
+			has_segment              = 1;
+		}
+		while( string_index < string_length )
+		{
+			if( LIBCSPLIT_TEMPLATE_STRING_FUNCTION( is_delimiter )(
+			     &delimiter_table,
+			     string[ string_index ] ) == 0 )
+			{
+				break;
+			}
+			number_of_run_delimiters++;
+			string_index++;
+		}
+	}
+	/* Trailing delimiters, or a string only containing delimiters
+	 */
+	if( ( flags & LIBCSPLIT_TRANSCODE_FLAG_STRIP ) == 0 )
+	{
+		number_of_replacements = number_of_run_delimiters;
+
+		if( ( ( flags & LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS ) != 0 )
+		 && ( number_of_replacements > 1 ) )
+		{
+			number_of_replacements = 1;
+		}
+		while( number_of_replacements > 0 )
+		{
+			transcoded_string[ transcoded_string_index++ ] = replacement_delimiter;
+
+			number_of_replacements--;
+		}
+	}
+	transcoded_string[ transcoded_string_index ] = 0;
+
+	*transcoded_string_length = transcoded_string_index;
+
+	return( 1 );
+}
+
+#undef LIBCSPLIT_TEMPLATE_CHARACTER_T
+#undef LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE
+#undef LIBCSPLIT_TEMPLATE_SPLIT_STRING_T
+#undef LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T
+#undef LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION
+#undef LIBCSPLIT_TEMPLATE_STRING_FUNCTION
+#undef LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME
+
+#if defined( LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT )
+#undef LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT
+#endif
+
@@ -34,15 +34,77 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libcsplit_key_value_table {}		libcsplit_key_value_table_t;
+typedef struct libcsplit_narrow_record_reader {}	libcsplit_narrow_record_reader_t;
 typedef struct libcsplit_narrow_split_string {}	libcsplit_narrow_split_string_t;
+typedef struct libcsplit_narrow_stream_splitter {}	libcsplit_narrow_stream_splitter_t;
+typedef struct libcsplit_segment_index {}		libcsplit_segment_index_t;
+typedef struct libcsplit_segment_table {}		libcsplit_segment_table_t;
+typedef struct libcsplit_split_hierarchy {}		libcsplit_split_hierarchy_t;
+typedef struct libcsplit_utf16_split_string {}	libcsplit_utf16_split_string_t;
+typedef struct libcsplit_utf32_split_string {}	libcsplit_utf32_split_string_t;
 typedef struct libcsplit_wide_split_string {}	libcsplit_wide_split_string_t;
 
 #else
+typedef intptr_t libcsplit_key_value_table_t;
+typedef intptr_t libcsplit_narrow_record_reader_t;
 typedef intptr_t libcsplit_narrow_split_string_t;
+typedef intptr_t libcsplit_narrow_stream_splitter_t;
+typedef intptr_t libcsplit_segment_index_t;
+typedef intptr_t libcsplit_segment_table_t;
+typedef intptr_t libcsplit_split_hierarchy_t;
+typedef intptr_t libcsplit_utf16_split_string_t;
+typedef intptr_t libcsplit_utf32_split_string_t;
 typedef intptr_t libcsplit_wide_split_string_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The Arrow C data interface type definitions
+ * These must match the definitions of the Arrow C data interface
+ * specification and are guarded to allow other definitions to be used
+ */
+#if !defined( ARROW_C_DATA_INTERFACE )
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED	1
+#define ARROW_FLAG_NULLABLE		2
+#define ARROW_FLAG_MAP_KEYS_SORTED	4
+
+struct ArrowSchema
+{
+	const char *format;
+	const char *name;
+	const char *metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema **children;
+	struct ArrowSchema *dictionary;
+
+	void (*release)(
+	       struct ArrowSchema * );
+
+	void *private_data;
+};
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void **buffers;
+	struct ArrowArray **children;
+	struct ArrowArray *dictionary;
+
+	void (*release)(
+	       struct ArrowArray * );
+
+	void *private_data;
+};
+
+#endif /* !defined( ARROW_C_DATA_INTERFACE ) */
+
 #endif /* defined( HAVE_LOCAL_LIBCSPLIT ) */
 
 #endif /* !defined( _LIBCSPLIT_INTERNAL_TYPES_H ) */
@@ -0,0 +1,262 @@
+/*
+ * UTF-16 stream functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libcsplit_definitions.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_segment_table.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_types.h"
+#include "libcsplit_utf16_stream.h"
+
+/* Searches a UTF-16 stream for a specific code unit
+ * The code unit is compared as stored in the stream, a big-endian code unit
+ * must be byte swapped by the caller
+ * Returns the offset of the code unit or the stream size if not found
+ */
+static size_t libcsplit_utf16_stream_search_code_unit(
+               const uint8_t *utf16_stream,
+               size_t utf16_stream_size,
+               uint16_t code_unit )
+{
+	const uint8_t *result = NULL;
+
+	result = libcsplit_simd_search_uint16_little_endian(
+	          utf16_stream,
+	          code_unit,
+	          utf16_stream_size );
+
+	if( result == NULL )
+	{
+		return( utf16_stream_size );
+	}
+	return( (size_t) ( result - utf16_stream ) );
+}
+
+/* Splits a UTF-16 stream
+ * The code units are compared in the byte order of the stream, hence the stream
+ * does not need to be converted. The stream ends at the first end-of-string
+ * code unit or at the end of the stream. The segment offsets and sizes are in
+ * bytes relative to the start of the stream and exclude the delimiter
+ * Make sure the value segment_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_utf16_stream_split(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint16_t delimiter,
+     int byte_order,
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcsplit_utf16_stream_split";
+	size_t segment_size       = 0;
+	size_t stream_index       = 0;
+	size_t stream_size        = 0;
+	uint16_t stream_delimiter = 0;
+	int number_of_segments    = 0;
+	int segment_index         = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != LIBCSPLIT_ENDIAN_BIG )
+	 && ( byte_order != LIBCSPLIT_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment table already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The search compares code units read as little-endian hence
+	 * the delimiter of a big-endian stream is byte swapped
+	 */
+	if( byte_order == LIBCSPLIT_ENDIAN_BIG )
+	{
+		stream_delimiter = (uint16_t) ( ( delimiter >> 8 ) | ( delimiter << 8 ) );
+	}
+	else
+	{
+		stream_delimiter = delimiter;
+	}
+	/* The stream ends at the first end-of-string code unit,
+	 * which is the same in either byte order
+	 */
+	stream_size = libcsplit_utf16_stream_search_code_unit(
+	               utf16_stream,
+	               utf16_stream_size,
+	               0 );
+
+	/* An empty stream has no segments
+	 */
+	if( stream_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the number of segments
+	 */
+	number_of_segments = 1;
+
+	while( stream_index < stream_size )
+	{
+		segment_size = libcsplit_utf16_stream_search_code_unit(
+		                &( utf16_stream[ stream_index ] ),
+		                stream_size - stream_index,
+		                stream_delimiter );
+
+		stream_index += segment_size;
+
+		if( stream_index >= stream_size )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		stream_index += 2;
+	}
+	if( libcsplit_segment_table_initialize(
+	     segment_table,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize segment table.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the segments
+	 */
+	stream_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_size = libcsplit_utf16_stream_search_code_unit(
+		                &( utf16_stream[ stream_index ] ),
+		                stream_size - stream_index,
+		                stream_delimiter );
+
+		if( libcsplit_segment_table_set_segment_by_index(
+		     *segment_table,
+		     segment_index,
+		     stream_index,
+		     segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		stream_index += segment_size + 2;
+	}
+	return( 1 );
+
+on_error:
+	if( *segment_table != NULL )
+	{
+		libcsplit_segment_table_free(
+		 segment_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
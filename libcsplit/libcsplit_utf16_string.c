@@ -0,0 +1,265 @@
+/*
+ * UTF-16 string functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_utf16_split_string.h"
+#include "libcsplit_utf16_string.h"
+#include "libcsplit_types.h"
+
+/* The string functions are generated from the template
+ */
+#define LIBCSPLIT_TEMPLATE_CHARACTER_T				uint16_t
+#define LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit )		(uint32_t) ( code_unit )
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_T			libcsplit_utf16_split_string_t
+#define LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T		libcsplit_internal_utf16_split_string_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )	libcsplit_utf16_split_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION( name )		libcsplit_utf16_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( name )		"libcsplit_utf16_string_" name
+
+/* Single code units are searched for with the SIMD kernels
+ */
+#define LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) \
+	libcsplit_simd_search_uint16( string, code_unit, size )
+
+#include "libcsplit_string_template.h"
+
+/* Splits a UTF-16 string on a Unicode code point delimiter
+ * A delimiter in the basic multilingual plane is a single code unit and is
+ * split on with libcsplit_utf16_string_split. A supplementary plane delimiter
+ * is matched as a surrogate pair using a vectorized two code unit compare.
+ * A high surrogate is only valid as the first code unit of a pair, hence
+ * a segment never ends between a high and a low surrogate
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_utf16_string_split_code_point(
+     const uint16_t *string,
+     size_t string_size,
+     uint32_t delimiter,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	libcsplit_internal_utf16_split_string_t *internal_split_string = NULL;
+	const uint16_t *match                                          = NULL;
+	uint16_t *string_copy                                          = NULL;
+	static char *function                                          = "libcsplit_utf16_string_split_code_point";
+	size_t segment_length                                          = 0;
+	size_t string_index                                            = 0;
+	size_t string_length                                           = 0;
+	uint16_t high_surrogate                                        = 0;
+	uint16_t low_surrogate                                         = 0;
+	int number_of_segments                                         = 0;
+	int segment_index                                              = 0;
+
+	if( ( delimiter == 0 )
+	 || ( delimiter > 0x0010ffffUL )
+	 || ( ( delimiter >= 0x0000d800UL )
+	  &&  ( delimiter <= 0x0000dfffUL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported delimiter: 0x%08" PRIx32 ".",
+		 function,
+		 delimiter );
+
+		return( -1 );
+	}
+	/* A delimiter in the basic multilingual plane cannot be part of a surrogate pair
+	 */
+	if( delimiter < 0x00010000UL )
+	{
+		return( libcsplit_utf16_string_split(
+		         string,
+		         string_size,
+		         (uint16_t) delimiter,
+		         split_string,
+		         error ) );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( string_size == 0 )
+	 || ( string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	delimiter     -= 0x00010000UL;
+	high_surrogate = (uint16_t) ( 0xd800 + ( delimiter >> 10 ) );
+	low_surrogate  = (uint16_t) ( 0xdc00 + ( delimiter & 0x000003ffUL ) );
+
+	/* The string ends at the first end of string character or the last character
+	 */
+	match = libcsplit_simd_search_uint16(
+	         string,
+	         0,
+	         string_size - 1 );
+
+	if( match == NULL )
+	{
+		string_length = string_size - 1;
+	}
+	else
+	{
+		string_length = (size_t) ( match - string );
+	}
+	/* Determine the number of segments
+	 */
+	number_of_segments = 1;
+
+	while( string_index < string_length )
+	{
+		match = libcsplit_simd_search_uint16_pair(
+		         &( string[ string_index ] ),
+		         high_surrogate,
+		         low_surrogate,
+		         string_length - string_index );
+
+		if( match == NULL )
+		{
+			break;
+		}
+		if( number_of_segments == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_segments++;
+
+		string_index = (size_t) ( match - string ) + 2;
+	}
+	if( libcsplit_utf16_split_string_initialize(
+	     split_string,
+	     string,
+	     string_length + 1,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_utf16_split_string_t *) *split_string;
+
+	/* Determine the segments
+	 * the segments are terminated in the copy of the string by overwriting
+	 * the high surrogate of the delimiter
+	 */
+	string_copy  = internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		match = libcsplit_simd_search_uint16_pair(
+		         &( string_copy[ string_index ] ),
+		         high_surrogate,
+		         low_surrogate,
+		         string_length - string_index );
+
+		if( match == NULL )
+		{
+			segment_length = string_length - string_index;
+		}
+		else
+		{
+			segment_length = (size_t) ( match - &( string_copy[ string_index ] ) );
+		}
+		string_copy[ string_index + segment_length ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = &( string_copy[ string_index ] );
+		internal_split_string->segment_sizes[ segment_index ] = segment_length + 1;
+
+		string_index += segment_length + 2;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_utf16_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
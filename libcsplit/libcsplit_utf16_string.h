@@ -0,0 +1,103 @@
+/*
+ * UTF-16 string functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_UTF16_STRING_H )
+#define _LIBCSPLIT_UTF16_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split(
+     const uint16_t *string,
+     size_t string_size,
+     uint16_t delimiter,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split_code_point(
+     const uint16_t *string,
+     size_t string_size,
+     uint32_t delimiter,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split_binary(
+     const uint16_t *string,
+     size_t string_size,
+     uint16_t delimiter,
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split_multi_string(
+     const uint16_t *string,
+     size_t string_size,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split_path(
+     const uint16_t *path,
+     size_t path_size,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_split_with_options(
+     const uint16_t *string,
+     size_t string_size,
+     uint16_t delimiter,
+     uint8_t flags,
+     const uint16_t *trim_characters,
+     size_t number_of_trim_characters,
+     libcsplit_utf16_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf16_string_transcode_delimiters(
+     const uint16_t *string,
+     size_t string_size,
+     const uint16_t *delimiters,
+     size_t number_of_delimiters,
+     uint16_t replacement_delimiter,
+     uint8_t flags,
+     uint16_t *transcoded_string,
+     size_t transcoded_string_size,
+     size_t *transcoded_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_UTF16_STRING_H ) */
+
@@ -0,0 +1,48 @@
+/*
+ * UTF-32 string functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_utf32_split_string.h"
+#include "libcsplit_utf32_string.h"
+#include "libcsplit_types.h"
+
+/* The string functions are generated from the template
+ */
+#define LIBCSPLIT_TEMPLATE_CHARACTER_T				uint32_t
+#define LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit )		(uint32_t) ( code_unit )
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_T			libcsplit_utf32_split_string_t
+#define LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T		libcsplit_internal_utf32_split_string_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )	libcsplit_utf32_split_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION( name )		libcsplit_utf32_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( name )		"libcsplit_utf32_string_" name
+
+/* Single code units are searched for with the SIMD kernels
+ */
+#define LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) \
+	libcsplit_simd_search_uint32( string, code_unit, size )
+
+#include "libcsplit_string_template.h"
+
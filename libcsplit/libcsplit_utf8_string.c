@@ -0,0 +1,519 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_narrow_split_string.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_types.h"
+#include "libcsplit_utf8_string.h"
+
+/* Determines the size of the UTF-8 sequence that starts with a non-ASCII byte
+ * The sequence is validated as specified by table 3-7 of the Unicode standard,
+ * hence overlong sequences, surrogates and code points beyond U+10FFFF are rejected
+ * Returns the size of the sequence or 0 if the sequence is invalid or incomplete
+ */
+int libcsplit_utf8_string_get_sequence_size(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length )
+{
+	uint8_t maximum_second_byte = 0xbf;
+	uint8_t minimum_second_byte = 0x80;
+	int sequence_index          = 0;
+	int sequence_size           = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf8_string_length == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( utf8_string[ 0 ] >= 0xc2 )
+	 && ( utf8_string[ 0 ] <= 0xdf ) )
+	{
+		sequence_size = 2;
+	}
+	else if( ( utf8_string[ 0 ] >= 0xe0 )
+	      && ( utf8_string[ 0 ] <= 0xef ) )
+	{
+		if( utf8_string[ 0 ] == 0xe0 )
+		{
+			minimum_second_byte = 0xa0;
+		}
+		else if( utf8_string[ 0 ] == 0xed )
+		{
+			maximum_second_byte = 0x9f;
+		}
+		sequence_size = 3;
+	}
+	else if( ( utf8_string[ 0 ] >= 0xf0 )
+	      && ( utf8_string[ 0 ] <= 0xf4 ) )
+	{
+		if( utf8_string[ 0 ] == 0xf0 )
+		{
+			minimum_second_byte = 0x90;
+		}
+		else if( utf8_string[ 0 ] == 0xf4 )
+		{
+			maximum_second_byte = 0x8f;
+		}
+		sequence_size = 4;
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( (size_t) sequence_size > utf8_string_length )
+	{
+		return( 0 );
+	}
+	if( ( utf8_string[ 1 ] < minimum_second_byte )
+	 || ( utf8_string[ 1 ] > maximum_second_byte ) )
+	{
+		return( 0 );
+	}
+	for( sequence_index = 2;
+	     sequence_index < sequence_size;
+	     sequence_index++ )
+	{
+		if( ( utf8_string[ sequence_index ] & 0xc0 ) != 0x80 )
+		{
+			return( 0 );
+		}
+	}
+	return( sequence_size );
+}
+
+/* Retrieves the Unicode code point of a validated UTF-8 sequence
+ * Returns the code point
+ */
+uint32_t libcsplit_utf8_string_get_code_point(
+          const uint8_t *utf8_sequence,
+          int utf8_sequence_size )
+{
+	uint32_t code_point = 0;
+	int sequence_index  = 0;
+
+	if( utf8_sequence_size == 2 )
+	{
+		code_point = utf8_sequence[ 0 ] & 0x1f;
+	}
+	else if( utf8_sequence_size == 3 )
+	{
+		code_point = utf8_sequence[ 0 ] & 0x0f;
+	}
+	else if( utf8_sequence_size == 4 )
+	{
+		code_point = utf8_sequence[ 0 ] & 0x07;
+	}
+	else
+	{
+		return( (uint32_t) utf8_sequence[ 0 ] );
+	}
+	for( sequence_index = 1;
+	     sequence_index < utf8_sequence_size;
+	     sequence_index++ )
+	{
+		code_point <<= 6;
+		code_point  |= utf8_sequence[ sequence_index ] & 0x3f;
+	}
+	return( code_point );
+}
+
+/* Copies a Unicode code point to a UTF-8 sequence
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_utf8_string_copy_from_code_point(
+     uint32_t code_point,
+     uint8_t *utf8_sequence,
+     size_t utf8_sequence_size,
+     size_t *utf8_sequence_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_utf8_string_copy_from_code_point";
+	size_t sequence_index = 0;
+	size_t sequence_size  = 0;
+
+	if( utf8_sequence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 sequence.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_sequence_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 sequence length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( code_point == 0 )
+	 || ( code_point > 0x0010ffffUL )
+	 || ( ( code_point >= 0x0000d800UL )
+	  &&  ( code_point <= 0x0000dfffUL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported code point: 0x%08" PRIx32 ".",
+		 function,
+		 code_point );
+
+		return( -1 );
+	}
+	if( code_point < 0x00000080UL )
+	{
+		sequence_size = 1;
+	}
+	else if( code_point < 0x00000800UL )
+	{
+		sequence_size = 2;
+	}
+	else if( code_point < 0x00010000UL )
+	{
+		sequence_size = 3;
+	}
+	else
+	{
+		sequence_size = 4;
+	}
+	if( sequence_size > utf8_sequence_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 sequence too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The continuation bytes contain 6 bits of the code point each
+	 */
+	for( sequence_index = sequence_size - 1;
+	     sequence_index > 0;
+	     sequence_index-- )
+	{
+		utf8_sequence[ sequence_index ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+
+		code_point >>= 6;
+	}
+	if( sequence_size == 1 )
+	{
+		utf8_sequence[ 0 ] = (uint8_t) code_point;
+	}
+	else
+	{
+		utf8_sequence[ 0 ] = (uint8_t) ( ( 0xff00 >> sequence_size ) | code_point );
+	}
+	*utf8_sequence_length = sequence_size;
+
+	return( 1 );
+}
+
+/* Searches a UTF-8 string for the UTF-8 sequence of a delimiter
+ * The string must have been validated, hence a matching first byte and
+ * continuation bytes always correspond to the delimiter
+ * Returns the index of the delimiter or utf8_string_length if not found
+ */
+static size_t libcsplit_utf8_string_search_delimiter(
+               const uint8_t *utf8_string,
+               size_t utf8_string_length,
+               const uint8_t *delimiter,
+               size_t delimiter_length )
+{
+	const uint8_t *match = NULL;
+	size_t string_index  = 0;
+
+	while( ( string_index + delimiter_length ) <= utf8_string_length )
+	{
+#if defined( HAVE_MEMCHR ) || defined( WINAPI )
+		match = (const uint8_t *) narrow_string_search_character(
+		                           &( utf8_string[ string_index ] ),
+		                           delimiter[ 0 ],
+		                           utf8_string_length - string_index );
+
+		if( match == NULL )
+		{
+			break;
+		}
+		string_index = (size_t) ( match - utf8_string );
+#else
+		if( utf8_string[ string_index ] != delimiter[ 0 ] )
+		{
+			string_index++;
+
+			continue;
+		}
+#endif
+		if( ( string_index + delimiter_length ) > utf8_string_length )
+		{
+			break;
+		}
+		if( memory_compare(
+		     &( utf8_string[ string_index + 1 ] ),
+		     &( delimiter[ 1 ] ),
+		     delimiter_length - 1 ) == 0 )
+		{
+			return( string_index );
+		}
+		string_index++;
+	}
+	return( utf8_string_length );
+}
+
+/* Splits a UTF-8 string on a Unicode code point delimiter
+ * The string is validated in the same scan that counts the delimiters. Runs of
+ * ASCII characters are skipped with a vectorized filter that stops on the end-of-string
+ * character, an ASCII delimiter or the first byte of a multi-byte sequence, only
+ * the multi-byte sequences are validated and compared to the delimiter.
+ * The string ends at the first end-of-string character or the last character
+ * Make sure the value split_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_utf8_string_split(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t delimiter,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_delimiter[ 4 ];
+
+	libcsplit_internal_narrow_split_string_t *internal_split_string = NULL;
+	uint8_t *string_copy                                            = NULL;
+	static char *function                                           = "libcsplit_utf8_string_split";
+	size_t segment_length                                           = 0;
+	size_t string_index                                             = 0;
+	size_t string_length                                            = 0;
+	size_t utf8_delimiter_length                                    = 0;
+	uint8_t stop_byte                                               = 0;
+	int number_of_segments                                          = 0;
+	int segment_index                                               = 0;
+	int sequence_size                                               = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( split_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *split_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcsplit_utf8_string_copy_from_code_point(
+	     delimiter,
+	     utf8_delimiter,
+	     4,
+	     &utf8_delimiter_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy delimiter to UTF-8 sequence.",
+		 function );
+
+		return( -1 );
+	}
+	/* An empty string has no segments
+	 */
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string[ 0 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	/* An ASCII delimiter is detected by the vectorized filter, a multi-byte
+	 * delimiter is compared when its sequence is validated
+	 */
+	if( utf8_delimiter_length == 1 )
+	{
+		stop_byte = utf8_delimiter[ 0 ];
+	}
+	/* Validate the string and determine the number of segments
+	 */
+	string_length      = utf8_string_size - 1;
+	number_of_segments = 1;
+
+	while( string_index < string_length )
+	{
+		string_index += libcsplit_simd_span_ascii(
+		                 &( utf8_string[ string_index ] ),
+		                 stop_byte,
+		                 string_length - string_index );
+
+		if( string_index >= string_length )
+		{
+			break;
+		}
+		if( utf8_string[ string_index ] == 0 )
+		{
+			string_length = string_index;
+
+			break;
+		}
+		if( utf8_string[ string_index ] < 0x80 )
+		{
+			sequence_size = 1;
+		}
+		else
+		{
+			sequence_size = libcsplit_utf8_string_get_sequence_size(
+			                 &( utf8_string[ string_index ] ),
+			                 string_length - string_index );
+
+			if( sequence_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: invalid UTF-8 sequence at index: %" PRIzu ".",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+		}
+		if( ( (size_t) sequence_size == utf8_delimiter_length )
+		 && ( memory_compare(
+		       &( utf8_string[ string_index ] ),
+		       utf8_delimiter,
+		       utf8_delimiter_length ) == 0 ) )
+		{
+			if( number_of_segments == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of segments value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_segments++;
+		}
+		string_index += (size_t) sequence_size;
+	}
+	if( libcsplit_narrow_split_string_initialize(
+	     split_string,
+	     (const char *) utf8_string,
+	     string_length + 1,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string = (libcsplit_internal_narrow_split_string_t *) *split_string;
+
+	/* Determine the segments
+	 * the segments are terminated in the copy of the string,
+	 * the string has been validated hence the delimiter can be searched for directly
+	 */
+	string_copy  = (uint8_t *) internal_split_string->string;
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment_length = libcsplit_utf8_string_search_delimiter(
+		                  &( string_copy[ string_index ] ),
+		                  string_length - string_index,
+		                  utf8_delimiter,
+		                  utf8_delimiter_length );
+
+		string_copy[ string_index + segment_length ] = 0;
+
+		internal_split_string->segments[ segment_index ]      = (char *) &( string_copy[ string_index ] );
+		internal_split_string->segment_sizes[ segment_index ] = segment_length + 1;
+
+		string_index += segment_length + utf8_delimiter_length;
+	}
+	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
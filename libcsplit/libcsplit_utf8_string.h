@@ -0,0 +1,64 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_UTF8_STRING_H )
+#define _LIBCSPLIT_UTF8_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_extern.h"
+#include "libcsplit_libcerror.h"
+#include "libcsplit_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libcsplit_utf8_string_get_sequence_size(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length );
+
+uint32_t libcsplit_utf8_string_get_code_point(
+          const uint8_t *utf8_sequence,
+          int utf8_sequence_size );
+
+int libcsplit_utf8_string_copy_from_code_point(
+     uint32_t code_point,
+     uint8_t *utf8_sequence,
+     size_t utf8_sequence_size,
+     size_t *utf8_sequence_length,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_utf8_string_split(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t delimiter,
+     libcsplit_narrow_split_string_t **split_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_UTF8_STRING_H ) */
+
@@ -0,0 +1,207 @@
+/*
+ * Variable-length integer functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+#include "libcsplit_varint.h"
+
+/* Encodes a 64-bit value as a variable-length integer
+ * The value is stored in groups of 7 bits, least significant group first,
+ * where the most significant bit of a byte indicates another byte follows
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_varint_encode(
+     uint64_t value,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *encoded_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_varint_encode";
+	size_t byte_index     = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoded_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoded size.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( byte_index >= byte_stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream[ byte_index ] = (uint8_t) ( value & 0x7f );
+
+		value >>= 7;
+
+		if( value != 0 )
+		{
+			byte_stream[ byte_index ] |= 0x80;
+		}
+		byte_index++;
+	}
+	while( value != 0 );
+
+	*encoded_size = byte_index;
+
+	return( 1 );
+}
+
+/* Decodes a variable-length integer into a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_varint_decode(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t *value,
+     size_t *decoded_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcsplit_varint_decode";
+	size_t byte_index     = 0;
+	uint64_t safe_value   = 0;
+	uint8_t bit_shift     = 0;
+	uint8_t byte_value    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded size.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( ( byte_index >= byte_stream_size )
+		 || ( byte_index >= LIBCSPLIT_VARINT_MAXIMUM_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid variable-length integer - data too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_value = byte_stream[ byte_index++ ];
+
+		/* The tenth byte can only contain the most significant bit of the value
+		 */
+		if( ( byte_index == LIBCSPLIT_VARINT_MAXIMUM_SIZE )
+		 && ( byte_value > 0x01 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid variable-length integer - value too large.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value |= (uint64_t) ( byte_value & 0x7f ) << bit_shift;
+
+		bit_shift += 7;
+	}
+	while( ( byte_value & 0x80 ) != 0 );
+
+	*value        = safe_value;
+	*decoded_size = byte_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,57 @@
+/*
+ * Variable-length integer functions
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCSPLIT_VARINT_H )
+#define _LIBCSPLIT_VARINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcsplit_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of an encoded 64-bit variable-length integer
+ */
+#define LIBCSPLIT_VARINT_MAXIMUM_SIZE	10
+
+int libcsplit_varint_encode(
+     uint64_t value,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *encoded_size,
+     libcerror_error_t **error );
+
+int libcsplit_varint_decode(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t *value,
+     size_t *decoded_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCSPLIT_VARINT_H ) */
+
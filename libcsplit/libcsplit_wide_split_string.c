@@ -20,31 +20,42 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <wide_string.h>
 #include <types.h>
 
+#include "libcsplit_definitions.h"
 #include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_serialization.h"
 #include "libcsplit_wide_split_string.h"
 #include "libcsplit_types.h"
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Creates a split string
- * Make sure the value split_string is referencing, is set to NULL
+/* The generic split string functions are generated from the template
+ */
+#define LIBCSPLIT_TEMPLATE_CHARACTER_T				wchar_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_T			libcsplit_wide_split_string_t
+#define LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T		libcsplit_internal_wide_split_string_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )	libcsplit_wide_split_string_ ## name
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION_NAME( name )	"libcsplit_wide_split_string_" name
+
+#include "libcsplit_split_string_template.h"
+
+/* Determines the layout of the serialized split string
+ * The string is serialized as-is, which contains the segments
  * Returns 1 if successful or -1 on error
  */
-int libcsplit_wide_split_string_initialize(
-     libcsplit_wide_split_string_t **split_string,
-     const wchar_t *string,
-     size_t string_size,
-     int number_of_segments,
+int libcsplit_wide_split_string_get_serialization_layout(
+     libcsplit_internal_wide_split_string_t *internal_split_string,
+     libcsplit_serialization_layout_t *layout,
      libcerror_error_t **error )
 {
-	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_initialize";
+	static char *function = "libcsplit_wide_split_string_get_serialization_layout";
 
-	if( split_string == NULL )
+	if( internal_split_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -55,240 +66,101 @@ int libcsplit_wide_split_string_initialize(
 
 		return( -1 );
 	}
-	if( *split_string != NULL )
+	if( libcsplit_serialization_layout_set(
+	     layout,
+	     (uint8_t) sizeof( wchar_t ),
+	     internal_split_string->flags,
+	     (uint64_t) internal_split_string->number_of_segments,
+	     (uint64_t) internal_split_string->string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid split string value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to determine layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_segments < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
-		 "%s: invalid number of segments less than zero.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	internal_split_string = memory_allocate_structure(
-			         libcsplit_internal_wide_split_string_t );
+/* Retrieves the size of the serialized split string
+ * Returns 1 if successful or -1 on error
+ */
+int libcsplit_wide_split_string_get_serialized_size(
+     libcsplit_wide_split_string_t *split_string,
+     size_t *serialized_size,
+     libcerror_error_t **error )
+{
+	libcsplit_serialization_layout_t layout;
 
-	if( internal_split_string == NULL )
+	static char *function = "libcsplit_wide_split_string_get_serialized_size";
+
+	if( split_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create split string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid split string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_split_string,
-	     0,
-	     sizeof( libcsplit_internal_wide_split_string_t ) ) == NULL )
+	if( serialized_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear split string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
 		 function );
 
-		memory_free(
-		 internal_split_string );
-
 		return( -1 );
 	}
-	if( ( string != NULL )
-	 && ( string_size > 0 ) )
-	{
-		internal_split_string->string = wide_string_allocate(
-		                                 string_size );
-
-		if( internal_split_string->string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create string.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     internal_split_string->string,
-		     string,
-		     sizeof( wchar_t ) * ( string_size - 1 ) ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to copy string.",
-			 function );
-
-			goto on_error;
-		}
-		internal_split_string->string[ string_size - 1 ] = 0;
-		internal_split_string->string_size               = string_size;
-	}
-	if( number_of_segments > 0 )
-	{
-		internal_split_string->segments = (wchar_t **) memory_allocate(
-		                                                sizeof( wchar_t * ) * number_of_segments );
-
-		if( internal_split_string->segments == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create segments.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_set(
-		     internal_split_string->segments,
-		     0,
-		     sizeof( wchar_t * ) * number_of_segments ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear segments.",
-			 function );
-
-			goto on_error;
-		}
-		internal_split_string->segment_sizes = (size_t *) memory_allocate(
-		                                                   sizeof( size_t ) * number_of_segments );
-
-		if( internal_split_string->segment_sizes == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create segment sizes.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_set(
-		     internal_split_string->segment_sizes,
-		     0,
-		     sizeof( size_t ) * number_of_segments ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear segment sizes.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	internal_split_string->number_of_segments = number_of_segments;
-
-	*split_string = (libcsplit_wide_split_string_t *) internal_split_string;
-
-	return( 1 );
-
-on_error:
-	if( internal_split_string != NULL )
-	{
-		if( internal_split_string->segment_sizes != NULL )
-		{
-			memory_free(
-			 internal_split_string->segment_sizes );
-		}
-		if( internal_split_string->segments != NULL )
-		{
-			memory_free(
-			 internal_split_string->segments );
-		}
-		if( internal_split_string->string != NULL )
-		{
-			memory_free(
-			 internal_split_string->string );
-		}
-		memory_free(
-		 internal_split_string );
-	}
-	return( -1 );
-}
-
-/* Frees a split string
- * Returns 1 if successful or -1 on error
- */
-int libcsplit_wide_split_string_free(
-     libcsplit_wide_split_string_t **split_string,
-     libcerror_error_t **error )
-{
-	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_free";
-
-	if( split_string == NULL )
+	if( libcsplit_wide_split_string_get_serialization_layout(
+	     (libcsplit_internal_wide_split_string_t *) split_string,
+	     &layout,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid split string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serialization layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( *split_string != NULL )
-	{
-		internal_split_string = (libcsplit_internal_wide_split_string_t *) *split_string;
-		*split_string         = NULL;
+	*serialized_size = layout.serialized_size;
 
-		if( internal_split_string->string != NULL )
-		{
-			memory_free(
-			 internal_split_string->string );
-		}
-		if( internal_split_string->segments != NULL )
-		{
-			memory_free(
-			 internal_split_string->segments );
-		}
-		if( internal_split_string->segment_sizes != NULL )
-		{
-			memory_free(
-			 internal_split_string->segment_sizes );
-		}
-		memory_free(
-		 internal_split_string );
-	}
 	return( 1 );
 }
 
-/* Retrieves the string
+/* Serializes the split string
+ * The byte stream consists of a header, a segment table and the string data
+ * and can be reloaded with libcsplit_wide_split_string_deserialize_file.
+ * The string data is stored as-is, including the end-of-string characters
+ * that replaced the delimiters, and the header stores the split string flags,
+ * hence the reloaded split string has the same string and segments
  * Returns 1 if successful or -1 on error
  */
-int libcsplit_wide_split_string_get_string(
+int libcsplit_wide_split_string_serialize(
      libcsplit_wide_split_string_t *split_string,
-     wchar_t **string,
-     size_t *string_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
      libcerror_error_t **error )
 {
+	libcsplit_serialization_layout_t layout;
+
 	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_get_string";
+	static char *function                                         = "libcsplit_wide_split_string_serialize";
+	size_t data_offset                                            = 0;
+	size_t string_index                                           = 0;
+	uint64_t segment_offset                                       = 0;
+	int segment_index                                             = 0;
 
 	if( split_string == NULL )
 	{
@@ -303,248 +175,298 @@ int libcsplit_wide_split_string_get_string(
 	}
 	internal_split_string = (libcsplit_internal_wide_split_string_t *) split_string;
 
-	if( string == NULL )
+	if( libcsplit_wide_split_string_get_serialization_layout(
+	     internal_split_string,
+	     &layout,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serialization layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_size == NULL )
+	if( libcsplit_serialization_layout_write_header(
+	     &layout,
+	     byte_stream,
+	     byte_stream_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
 		 function );
 
 		return( -1 );
 	}
-	*string      = internal_split_string->string;
-	*string_size = internal_split_string->string_size;
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
+	{
+		if( internal_split_string->segments[ segment_index ] == NULL )
+		{
+			segment_offset = LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET;
+		}
+		else
+		{
+			segment_offset = (uint64_t) ( internal_split_string->segments[ segment_index ] - internal_split_string->string );
+		}
+		if( libcsplit_serialization_layout_set_segment(
+		     &layout,
+		     byte_stream,
+		     (uint64_t) segment_index,
+		     segment_offset,
+		     (uint64_t) internal_split_string->segment_sizes[ segment_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+	}
+	/* The characters are stored in little-endian
+	 */
+	data_offset = layout.data_offset;
 
+	for( string_index = 0;
+	     string_index < internal_split_string->string_size;
+	     string_index++ )
+	{
+#if SIZEOF_WCHAR_T == 4
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ data_offset ] ),
+		 (uint32_t) internal_split_string->string[ string_index ] );
+#else
+		byte_stream_copy_from_uint16_little_endian(
+		 &( byte_stream[ data_offset ] ),
+		 (uint16_t) internal_split_string->string[ string_index ] );
+#endif
+		data_offset += sizeof( wchar_t );
+	}
 	return( 1 );
 }
 
-/* Retrieves the number of segments
+/* Deserializes a split string from a file
+ * The file is mapped read-only into memory and the string and segments reference
+ * the mapping, which is unmapped when the split string is freed. The string, segments
+ * and flags are the same as those of the serialized split string, except that
+ * the LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY flag is always set, refer to
+ * libcsplit_wide_split_string_get_flags.
+ * Make sure the value split_string is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libcsplit_wide_split_string_get_number_of_segments(
-     libcsplit_wide_split_string_t *split_string,
-     int *number_of_segments,
+int libcsplit_wide_split_string_deserialize_file(
+     const char *filename,
+     libcsplit_wide_split_string_t **split_string,
      libcerror_error_t **error )
 {
+	libcsplit_serialization_layout_t layout;
+
 	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_get_number_of_segments";
+	libcsplit_mapped_file_t *mapped_file                          = NULL;
+	static char *function                                         = "libcsplit_wide_split_string_deserialize_file";
+	uint64_t segment_offset                                       = 0;
+	uint64_t segment_size                                         = 0;
+	int segment_index                                             = 0;
 
-	if( split_string == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid split string.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_split_string = (libcsplit_internal_wide_split_string_t *) split_string;
-
-	if( number_of_segments == NULL )
+	if( split_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of segments.",
+		 "%s: invalid split string.",
 		 function );
 
 		return( -1 );
 	}
-	*number_of_segments = internal_split_string->number_of_segments;
-
-	return( 1 );
-}
-
-/* Retrieves a specific segment
- * Returns 1 if successful or -1 on error
- */
-int libcsplit_wide_split_string_get_segment_by_index(
-     libcsplit_wide_split_string_t *split_string,
-     int segment_index,
-     wchar_t **string_segment,
-     size_t *string_segment_size,
-     libcerror_error_t **error )
-{
-	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_get_segment_by_index";
-
-	if( split_string == NULL )
+	if( *split_string != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid split string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid split string value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_split_string = (libcsplit_internal_wide_split_string_t *) split_string;
-
-	if( ( segment_index < 0 )
-	 || ( segment_index >= internal_split_string->number_of_segments ) )
+	/* The string data is referenced without conversion
+	 */
+	if( !_BYTE_STREAM_HOST_IS_ENDIAN_LITTLE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported host byte order.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_segment == NULL )
+	if( libcsplit_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string segment.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( string_segment_size == NULL )
+	if( libcsplit_mapped_file_open(
+	     mapped_file,
+	     filename,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string segment size.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
 
-		return( -1 );
+		goto on_error;
 	}
-	*string_segment      = internal_split_string->segments[ segment_index ];
-	*string_segment_size = internal_split_string->segment_sizes[ segment_index ];
-
-	return( 1 );
-}
-
-/* Sets a specific segment
- * Returns 1 if successful or -1 on error
- */
-int libcsplit_wide_split_string_set_segment_by_index(
-     libcsplit_wide_split_string_t *split_string,
-     int segment_index,
-     wchar_t *string_segment,
-     size_t string_segment_size,
-     libcerror_error_t **error )
-{
-	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
-	static char *function                                         = "libcsplit_wide_split_string_set_segment_by_index";
-	size_t string_segment_offset                                  = 0;
-
-	if( split_string == NULL )
+	if( libcsplit_serialization_layout_read_header(
+	     &layout,
+	     mapped_file->data,
+	     mapped_file->data_size,
+	     (uint8_t) sizeof( wchar_t ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid split string.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_split_string = (libcsplit_internal_wide_split_string_t *) split_string;
-
-	if( ( segment_index < 0 )
-	 || ( segment_index >= internal_split_string->number_of_segments ) )
+	if( layout.number_of_segments > (uint64_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of segments value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( string_segment_size > (size_t) SSIZE_MAX )
+	if( libcsplit_wide_split_string_initialize(
+	     split_string,
+	     NULL,
+	     0,
+	     (int) layout.number_of_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid string segment size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize split string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( string_segment == NULL )
-	{
-		if( string_segment_size != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid string segment size value out of bounds.",
-			 function );
+	internal_split_string = (libcsplit_internal_wide_split_string_t *) *split_string;
 
-			return( -1 );
-		}
-	}
-	else
+	internal_split_string->string      = (wchar_t *) &( mapped_file->data[ layout.data_offset ] );
+	internal_split_string->string_size = (size_t) layout.number_of_characters;
+	internal_split_string->mapped_file = mapped_file;
+	internal_split_string->flags       = layout.flags | LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY;
+
+	mapped_file = NULL;
+
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
 	{
-		if( string_segment < internal_split_string->string )
+		if( libcsplit_serialization_layout_get_segment(
+		     &layout,
+		     internal_split_string->mapped_file->data,
+		     (uint64_t) segment_index,
+		     &segment_offset,
+		     &segment_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid string segment value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		string_segment_offset = (size_t) ( string_segment - internal_split_string->string );
-
-		if( string_segment_offset >= internal_split_string->string_size )
+		if( segment_offset == LIBCSPLIT_SERIALIZATION_SEGMENT_OFFSET_NOT_SET )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid string segment value out of bounds.",
-			 function );
-
-			return( -1 );
+			continue;
 		}
-		string_segment_offset += string_segment_size;
-
-		if( string_segment_offset > internal_split_string->string_size )
+		/* Terminated segments are relied upon to end with an end-of-string character
+		 */
+		if( ( ( internal_split_string->flags & LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED ) == 0 )
+		 && ( segment_size > 0 )
+		 && ( internal_split_string->string[ segment_offset + segment_size - 1 ] != 0 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid string segment value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid segment: %d missing end-of-string character.",
+			 function,
+			 segment_index );
 
-			return( -1 );
+			goto on_error;
 		}
+		internal_split_string->segments[ segment_index ]      = &( internal_split_string->string[ segment_offset ] );
+		internal_split_string->segment_sizes[ segment_index ] = (size_t) segment_size;
 	}
-	internal_split_string->segments[ segment_index ]      = string_segment;
-	internal_split_string->segment_sizes[ segment_index ] = string_segment_size;
-
 	return( 1 );
+
+on_error:
+	if( *split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 split_string,
+		 NULL );
+	}
+	if( mapped_file != NULL )
+	{
+		libcsplit_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( -1 );
 }
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
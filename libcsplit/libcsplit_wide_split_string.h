@@ -27,6 +27,8 @@
 
 #include "libcsplit_extern.h"
 #include "libcsplit_libcerror.h"
+#include "libcsplit_mapped_file.h"
+#include "libcsplit_serialization.h"
 #include "libcsplit_types.h"
 
 #if defined( __cplusplus )
@@ -58,6 +60,14 @@ struct libcsplit_internal_wide_split_string
 	/* The segment sizes
 	 */
 	size_t *segment_sizes;
+
+	/* The mapped file, when the string references a memory mapped file
+	 */
+	libcsplit_mapped_file_t *mapped_file;
+
+	/* The flags
+	 */
+	uint8_t flags;
 };
 
 int libcsplit_wide_split_string_initialize(
@@ -79,6 +89,12 @@ int libcsplit_wide_split_string_get_string(
      size_t *string_size,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_get_flags(
+     libcsplit_wide_split_string_t *split_string,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
 LIBCSPLIT_EXTERN \
 int libcsplit_wide_split_string_get_number_of_segments(
      libcsplit_wide_split_string_t *split_string,
@@ -101,6 +117,44 @@ int libcsplit_wide_split_string_set_segment_by_index(
      size_t string_segment_size,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_get_joined_string_size(
+     libcsplit_wide_split_string_t *split_string,
+     size_t *joined_string_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_join(
+     libcsplit_wide_split_string_t *split_string,
+     wchar_t delimiter,
+     wchar_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libcsplit_wide_split_string_get_serialization_layout(
+     libcsplit_internal_wide_split_string_t *internal_split_string,
+     libcsplit_serialization_layout_t *layout,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_get_serialized_size(
+     libcsplit_wide_split_string_t *split_string,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_serialize(
+     libcsplit_wide_split_string_t *split_string,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_split_string_deserialize_file(
+     const char *filename,
+     libcsplit_wide_split_string_t **split_string,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
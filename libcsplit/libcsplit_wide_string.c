@@ -20,57 +20,193 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
+#include <wide_string.h>
 
 #include "libcsplit_libcerror.h"
+#include "libcsplit_simd.h"
+#include "libcsplit_utf8_string.h"
 #include "libcsplit_wide_split_string.h"
 #include "libcsplit_wide_string.h"
 #include "libcsplit_types.h"
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Splits a wide character string
+/* The string functions are generated from the template
+ */
+#define LIBCSPLIT_TEMPLATE_CHARACTER_T				wchar_t
+#define LIBCSPLIT_TEMPLATE_CODE_UNIT_VALUE( code_unit )		(uint32_t) ( code_unit )
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_T			libcsplit_wide_split_string_t
+#define LIBCSPLIT_TEMPLATE_INTERNAL_SPLIT_STRING_T		libcsplit_internal_wide_split_string_t
+#define LIBCSPLIT_TEMPLATE_SPLIT_STRING_FUNCTION( name )	libcsplit_wide_split_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION( name )		libcsplit_wide_string_ ## name
+#define LIBCSPLIT_TEMPLATE_STRING_FUNCTION_NAME( name )		"libcsplit_wide_string_" name
+
+/* Single code units are searched for with the SIMD kernel for wchar_t if the size
+ * of wchar_t is supported otherwise with wmemchr, wcschr is not bounded by size
+ */
+#if ( SIZEOF_WCHAR_T == 2 ) || ( SIZEOF_WCHAR_T == 4 )
+#define LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) \
+	libcsplit_simd_search_wide( string, code_unit, size )
+
+#elif defined( HAVE_WMEMCHR )
+#define LIBCSPLIT_TEMPLATE_SEARCH_CODE_UNIT( string, code_unit, size ) \
+	wide_string_search_character( string, code_unit, size )
+
+#endif
+
+#include "libcsplit_string_template.h"
+
+/* Appends a segment to a wide split string that is being built from an UTF-8 string
+ * The segments are resized when needed, the segment pointers are set after all segments are appended
+ * Returns 1 if successful or -1 on error
+ */
+static int libcsplit_wide_string_append_segment(
+            libcsplit_internal_wide_split_string_t *internal_split_string,
+            int *maximum_number_of_segments,
+            size_t segment_size,
+            libcerror_error_t **error )
+{
+	size_t *reallocated_segment_sizes = NULL;
+	wchar_t **reallocated_segments    = NULL;
+	static char *function             = "libcsplit_wide_string_append_segment";
+	int number_of_segments            = 0;
+
+	if( internal_split_string->number_of_segments >= *maximum_number_of_segments )
+	{
+		if( *maximum_number_of_segments == 0 )
+		{
+			number_of_segments = 16;
+		}
+		else if( *maximum_number_of_segments > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_segments = *maximum_number_of_segments * 2;
+		}
+		reallocated_segments = (wchar_t **) memory_reallocate(
+		                                     internal_split_string->segments,
+		                                     sizeof( wchar_t * ) * number_of_segments );
+
+		if( reallocated_segments == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segments.",
+			 function );
+
+			return( -1 );
+		}
+		internal_split_string->segments = reallocated_segments;
+
+		reallocated_segment_sizes = (size_t *) memory_reallocate(
+		                                        internal_split_string->segment_sizes,
+		                                        sizeof( size_t ) * number_of_segments );
+
+		if( reallocated_segment_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment sizes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_split_string->segment_sizes = reallocated_segment_sizes;
+
+		*maximum_number_of_segments = number_of_segments;
+	}
+	internal_split_string->segments[ internal_split_string->number_of_segments ]      = NULL;
+	internal_split_string->segment_sizes[ internal_split_string->number_of_segments ] = segment_size;
+
+	internal_split_string->number_of_segments += 1;
+
+	return( 1 );
+}
+
+/* Splits a UTF-8 string into a wide split string on a Unicode code point delimiter
+ * The UTF-8 string is validated, converted and split in a single pass directly
+ * into the string of the wide split string. Runs of ASCII characters are skipped
+ * with the vectorized filter of libcsplit_utf8_string_split and widened in bulk.
+ * If wchar_t is 16-bit, characters outside the basic multilingual plane are
+ * stored as surrogate pairs
+ * The string ends at the first end-of-string character or the last character
  * Make sure the value split_string is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libcsplit_wide_string_split(
-     const wchar_t *string,
-     size_t string_size,
-     wchar_t delimiter,
+int libcsplit_wide_string_split_from_utf8(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t delimiter,
      libcsplit_wide_split_string_t **split_string,
      libcerror_error_t **error )
 {
-	wchar_t *segment_start = NULL;
-	wchar_t *segment_end   = NULL;
-	wchar_t *string_end    = NULL;
-	wchar_t *string_start  = NULL;
-	static char *function  = "libcsplit_wide_string_split";
-	ssize_t segment_length = 0;
-	int number_of_segments = 0;
-	int segment_index      = 0;
-
-	if( string == NULL )
+	libcsplit_internal_wide_split_string_t *internal_split_string = NULL;
+	wchar_t *string                                               = NULL;
+	static char *function                                         = "libcsplit_wide_string_split_from_utf8";
+	size_t ascii_index                                            = 0;
+	size_t ascii_length                                           = 0;
+	size_t segment_start                                          = 0;
+	size_t string_index                                           = 0;
+	size_t utf8_string_index                                      = 0;
+	size_t utf8_string_length                                     = 0;
+	uint32_t code_point                                           = 0;
+	uint8_t stop_byte                                             = 0;
+	int maximum_number_of_segments                                = 0;
+	int segment_index                                             = 0;
+	int sequence_size                                             = 0;
+
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_size > (size_t) SSIZE_MAX )
+	if( utf8_string_size > (size_t) ( SSIZE_MAX / sizeof( wchar_t ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid string size value exceeds maximum.",
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
+	if( ( delimiter == 0 )
+	 || ( delimiter > 0x0010ffffUL )
+	 || ( ( delimiter >= 0x0000d800UL )
+	  &&  ( delimiter <= 0x0000dfffUL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported delimiter: 0x%08" PRIx32 ".",
+		 function,
+		 delimiter );
+
+		return( -1 );
+	}
 	if( split_string == NULL )
 	{
 		libcerror_error_set(
@@ -95,63 +231,22 @@ int libcsplit_wide_string_split(
 	}
 	/* An empty string has no segments
 	 */
-	if( ( string_size == 0 )
-	 || ( string[ 0 ] == 0 ) )
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string[ 0 ] == 0 ) )
 	{
 		return( 1 );
 	}
-	/* Determine the number of segments
+	/* An ASCII delimiter is detected by the vectorized filter
 	 */
-	segment_start = (wchar_t *) string;
-	string_end    = (wchar_t *) &( string[ string_size - 1 ] );
-
-	do
+	if( delimiter < 0x00000080UL )
 	{
-		segment_end = segment_start;
-
-		while( segment_end <= string_end )
-		{
-			if( ( segment_end == string_end )
-			 || ( *segment_end == 0 ) )
-			{
-				segment_end = NULL;
-
-				break;
-			}
-			else if( *segment_end == delimiter )
-			{
-				break;
-			}
-			segment_end++;
-		}
-		if( segment_end > string_end )
-		{
-			break;
-		}
-		segment_index++;
-
-		if( segment_end == NULL )
-		{
-			break;
-		}
-		if( segment_end == segment_start )
-		{
-			segment_start++;
-		}
-		else if( segment_end != string )
-		{
-			segment_start = segment_end + 1;
-		}
+		stop_byte = (uint8_t) delimiter;
 	}
-	while( segment_end != NULL );
-
-	number_of_segments = segment_index;
-
 	if( libcsplit_wide_split_string_initialize(
 	     split_string,
-	     string,
-	     string_size,
-	     number_of_segments,
+	     NULL,
+	     0,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -163,119 +258,143 @@ int libcsplit_wide_string_split(
 
 		goto on_error;
 	}
-	/* Do not bother with strings that do not need splitting
-	 */
-	if( number_of_segments == 0 )
-	{
-		return( 1 );
-	}
-	/* Determine the segments
-	 * empty segments are stored as strings only containing the end of character
+	internal_split_string = (libcsplit_internal_wide_split_string_t *) *split_string;
+
+	/* Every UTF-8 sequence converts to at most as many wide characters as it has bytes
 	 */
-	if( libcsplit_wide_split_string_get_string(
-	     *split_string,
-	     &string_start,
-	     &string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve split string.",
-		 function );
+	utf8_string_length = utf8_string_size - 1;
 
-		goto on_error;
-	}
-	if( string_start == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing string start.",
-		 function );
+	internal_split_string->string = (wchar_t *) memory_allocate(
+	                                             sizeof( wchar_t ) * ( utf8_string_length + 1 ) );
 
-		goto on_error;
-	}
-	if( string_size < 1 )
+	if( internal_split_string->string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
 		 function );
 
 		goto on_error;
 	}
-	segment_start = string_start;
-	string_end    = &( string_start[ string_size - 1 ] );
+	string = internal_split_string->string;
 
-	for( segment_index = 0;
-	     segment_index < number_of_segments;
-	     segment_index++ )
+	while( utf8_string_index < utf8_string_length )
 	{
-		segment_end = segment_start;
+		ascii_length = libcsplit_simd_span_ascii(
+		                &( utf8_string[ utf8_string_index ] ),
+		                stop_byte,
+		                utf8_string_length - utf8_string_index );
 
-		while( segment_end <= string_end )
+		for( ascii_index = 0;
+		     ascii_index < ascii_length;
+		     ascii_index++ )
 		{
-			if( ( segment_end == string_end )
-			 || ( *segment_end == 0 ) )
-			{
-				segment_end = NULL;
+			string[ string_index++ ] = (wchar_t) utf8_string[ utf8_string_index + ascii_index ];
+		}
+		utf8_string_index += ascii_length;
 
-				break;
-			}
-			else if( *segment_end == delimiter )
-			{
-				break;
-			}
-			segment_end++;
+		if( ( utf8_string_index >= utf8_string_length )
+		 || ( utf8_string[ utf8_string_index ] == 0 ) )
+		{
+			break;
 		}
-		if( segment_end == NULL )
+		if( utf8_string[ utf8_string_index ] < 0x80 )
 		{
-			segment_length = (ssize_t) ( string_end - segment_start );
+			code_point    = (uint32_t) utf8_string[ utf8_string_index ];
+			sequence_size = 1;
 		}
 		else
 		{
-			segment_length = (ssize_t) ( segment_end - segment_start );
+			sequence_size = libcsplit_utf8_string_get_sequence_size(
+			                 &( utf8_string[ utf8_string_index ] ),
+			                 utf8_string_length - utf8_string_index );
+
+			if( sequence_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: invalid UTF-8 sequence at index: %" PRIzu ".",
+				 function,
+				 utf8_string_index );
+
+				goto on_error;
+			}
+			code_point = libcsplit_utf8_string_get_code_point(
+			              &( utf8_string[ utf8_string_index ] ),
+			              sequence_size );
 		}
-		if( segment_length >= 0 )
+		utf8_string_index += (size_t) sequence_size;
+
+		if( code_point == delimiter )
 		{
-			segment_start[ segment_length ] = 0;
+			string[ string_index++ ] = 0;
 
-			if( libcsplit_wide_split_string_set_segment_by_index(
-			     *split_string,
-			     segment_index,
-			     segment_start,
-			     segment_length + 1,
+			if( libcsplit_wide_string_append_segment(
+			     internal_split_string,
+			     &maximum_number_of_segments,
+			     string_index - segment_start,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set split string segment: %d.",
-				 function,
-				 segment_index );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment.",
+				 function );
 
 				goto on_error;
 			}
+			segment_start = string_index;
 		}
-		if( segment_end == NULL )
-		{
-			break;
-		}
-		if( segment_end == string_start )
+#if SIZEOF_WCHAR_T == 2
+		else if( code_point >= 0x00010000UL )
 		{
-			segment_start++;
+			code_point -= 0x00010000UL;
+
+			string[ string_index++ ] = (wchar_t) ( 0xd800 + ( code_point >> 10 ) );
+			string[ string_index++ ] = (wchar_t) ( 0xdc00 + ( code_point & 0x000003ffUL ) );
 		}
+#endif
 		else
 		{
-			segment_start = segment_end + 1;
+			string[ string_index++ ] = (wchar_t) code_point;
 		}
 	}
+	string[ string_index++ ] = 0;
+
+	if( libcsplit_wide_string_append_segment(
+	     internal_split_string,
+	     &maximum_number_of_segments,
+	     string_index - segment_start,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment.",
+		 function );
+
+		goto on_error;
+	}
+	internal_split_string->string_size = string_index;
+
+	/* The segments are consecutive in the string
+	 */
+	string_index = 0;
+
+	for( segment_index = 0;
+	     segment_index < internal_split_string->number_of_segments;
+	     segment_index++ )
+	{
+		internal_split_string->segments[ segment_index ] = &( string[ string_index ] );
+
+		string_index += internal_split_string->segment_sizes[ segment_index ];
+	}
 	return( 1 );
 
 on_error:
@@ -43,6 +43,60 @@ int libcsplit_wide_string_split(
      libcsplit_wide_split_string_t **split_string,
      libcerror_error_t **error );
 
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_split_binary(
+     const wchar_t *string,
+     size_t string_size,
+     wchar_t delimiter,
+     libcsplit_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_split_from_utf8(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t delimiter,
+     libcsplit_wide_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_split_multi_string(
+     const wchar_t *string,
+     size_t string_size,
+     libcsplit_wide_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_split_path(
+     const wchar_t *path,
+     size_t path_size,
+     libcsplit_wide_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_split_with_options(
+     const wchar_t *string,
+     size_t string_size,
+     wchar_t delimiter,
+     uint8_t flags,
+     const wchar_t *trim_characters,
+     size_t number_of_trim_characters,
+     libcsplit_wide_split_string_t **split_string,
+     libcerror_error_t **error );
+
+LIBCSPLIT_EXTERN \
+int libcsplit_wide_string_transcode_delimiters(
+     const wchar_t *string,
+     size_t string_size,
+     const wchar_t *delimiters,
+     size_t number_of_delimiters,
+     wchar_t replacement_delimiter,
+     uint8_t flags,
+     wchar_t *transcoded_string,
+     size_t transcoded_string_size,
+     size_t *transcoded_string_length,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,677 @@
+/*
+ * Library Arrow functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+/* Tests the libcsplit_arrow_export_narrow_split_string function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_arrow_export_narrow_split_string(
+     void )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	const uint8_t *view                           = NULL;
+	char *string                                  = NULL;
+	size_t string_size                            = 0;
+	int32_t value_32bit                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	array.release  = NULL;
+	schema.release = NULL;
+
+	result = libcsplit_narrow_string_split(
+	          "first,second,a much longer segment,",
+	          36,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_string(
+	          split_string,
+	          &string,
+	          &string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_arrow_export_narrow_split_string(
+	          split_string,
+	          &array,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "array.release",
+	 array.release );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "schema.release",
+	 schema.release );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "schema.format[ 0 ]",
+	 (int) schema.format[ 0 ],
+	 (int) 'v' );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "schema.format[ 1 ]",
+	 (int) schema.format[ 1 ],
+	 (int) 'u' );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "array.n_buffers",
+	 array.n_buffers,
+	 (int64_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "array.buffers[ 0 ]",
+	 array.buffers[ 0 ] );
+
+	/* The string data is not copied
+	 */
+	CSPLIT_TEST_ASSERT_EQUAL_INTPTR(
+	 "array.buffers[ 2 ]",
+	 (intptr_t) array.buffers[ 2 ],
+	 (intptr_t) string );
+
+	/* The first segment is stored inline
+	 */
+	view = &( ( (const uint8_t *) array.buffers[ 1 ] )[ 0 ] );
+
+	memory_copy(
+	 &value_32bit,
+	 view,
+	 sizeof( int32_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 5 );
+
+	result = memory_compare(
+	          &( view[ 4 ] ),
+	          "first\0\0\0\0\0\0\0",
+	          12 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The third segment references the string
+	 */
+	view = &( ( (const uint8_t *) array.buffers[ 1 ] )[ 2 * 16 ] );
+
+	memory_copy(
+	 &value_32bit,
+	 view,
+	 sizeof( int32_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 21 );
+
+	result = memory_compare(
+	          &( view[ 4 ] ),
+	          "a mu",
+	          4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_copy(
+	 &value_32bit,
+	 &( view[ 8 ] ),
+	 sizeof( int32_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 0 );
+
+	memory_copy(
+	 &value_32bit,
+	 &( view[ 12 ] ),
+	 sizeof( int32_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 13 );
+
+	/* The last segment is empty
+	 */
+	view = &( ( (const uint8_t *) array.buffers[ 1 ] )[ 3 * 16 ] );
+
+	memory_copy(
+	 &value_32bit,
+	 view,
+	 sizeof( int32_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "value_32bit",
+	 value_32bit,
+	 (int32_t) 0 );
+
+	array.release(
+	 &array );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	schema.release(
+	 &schema );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	/* Test error cases
+	 */
+	result = libcsplit_arrow_export_narrow_split_string(
+	          NULL,
+	          &array,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_arrow_export_narrow_split_string(
+	          split_string,
+	          NULL,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_arrow_export_narrow_split_string(
+	          split_string,
+	          &array,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	/* Test libcsplit_arrow_export_narrow_split_string with malloc failing
+	 */
+	csplit_test_malloc_attempts_before_fail = 0;
+
+	result = libcsplit_arrow_export_narrow_split_string(
+	          split_string,
+	          &array,
+	          &schema,
+	          &error );
+
+	if( csplit_test_malloc_attempts_before_fail != -1 )
+	{
+		csplit_test_malloc_attempts_before_fail = -1;
+
+		if( array.release != NULL )
+		{
+			array.release(
+			 &array );
+		}
+		if( schema.release != NULL )
+		{
+			schema.release(
+			 &schema );
+		}
+	}
+	else
+	{
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array.release != NULL )
+	{
+		array.release(
+		 &array );
+	}
+	if( schema.release != NULL )
+	{
+		schema.release(
+		 &schema );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_arrow_export_narrow_split_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_arrow_export_narrow_split_strings(
+     void )
+{
+	struct ArrowArray array;
+	struct ArrowSchema schema;
+
+	libcsplit_narrow_split_string_t *split_strings[ 3 ] = { NULL, NULL, NULL };
+	libcerror_error_t *error                            = NULL;
+	const int32_t *offsets                              = NULL;
+	struct ArrowArray *child_array                      = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	array.release  = NULL;
+	schema.release = NULL;
+
+	result = libcsplit_narrow_string_split(
+	          "1 2 3 4  5",
+	          11,
+	          ' ',
+	          &( split_strings[ 0 ] ),
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_narrow_string_split(
+	          "split strings",
+	          14,
+	          ' ',
+	          &( split_strings[ 2 ] ),
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_arrow_export_narrow_split_strings(
+	          split_strings,
+	          3,
+	          &array,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "schema.format[ 1 ]",
+	 (int) schema.format[ 1 ],
+	 (int) 'l' );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "schema.n_children",
+	 schema.n_children,
+	 (int64_t) 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "array.length",
+	 array.length,
+	 (int64_t) 3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "array.n_children",
+	 array.n_children,
+	 (int64_t) 1 );
+
+	offsets = (const int32_t *) array.buffers[ 1 ];
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 1 ]",
+	 offsets[ 1 ],
+	 (int32_t) 6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 2 ]",
+	 offsets[ 2 ],
+	 (int32_t) 6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT32(
+	 "offsets[ 3 ]",
+	 offsets[ 3 ],
+	 (int32_t) 8 );
+
+	child_array = array.children[ 0 ];
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "child_array->length",
+	 child_array->length,
+	 (int64_t) 8 );
+
+	/* The child array has 2 variadic data buffers
+	 */
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "child_array->n_buffers",
+	 child_array->n_buffers,
+	 (int64_t) 5 );
+
+	array.release(
+	 &array );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "array.release",
+	 array.release );
+
+	schema.release(
+	 &schema );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "schema.release",
+	 schema.release );
+
+	/* Test error cases
+	 */
+	result = libcsplit_arrow_export_narrow_split_strings(
+	          NULL,
+	          3,
+	          &array,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_arrow_export_narrow_split_strings(
+	          split_strings,
+	          -1,
+	          &array,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_arrow_export_narrow_split_strings(
+	          split_strings,
+	          3,
+	          NULL,
+	          &schema,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_arrow_export_narrow_split_strings(
+	          split_strings,
+	          3,
+	          &array,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_split_string_free(
+	          &( split_strings[ 2 ] ),
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &( split_strings[ 0 ] ),
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array.release != NULL )
+	{
+		array.release(
+		 &array );
+	}
+	if( schema.release != NULL )
+	{
+		schema.release(
+		 &schema );
+	}
+	if( split_strings[ 2 ] != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &( split_strings[ 2 ] ),
+		 NULL );
+	}
+	if( split_strings[ 0 ] != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &( split_strings[ 0 ] ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_arrow_export_narrow_split_string",
+	 csplit_test_arrow_export_narrow_split_string );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_arrow_export_narrow_split_strings",
+	 csplit_test_arrow_export_narrow_split_strings );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
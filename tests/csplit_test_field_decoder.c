@@ -0,0 +1,1124 @@
+/*
+ * Library field decoder functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#include "../libcsplit/libcsplit_field_decoder.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+/* Tests the libcsplit_field_decoder_decode_uint64 function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_uint64(
+     void )
+{
+	char string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	size_t string_length     = 0;
+	size_t string_offset     = 0;
+	uint64_t expected_value  = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t value           = 1;
+	int result               = 0;
+
+	/* Use a pseudo random sequence of digits
+	 */
+	for( string_index = 0;
+	     string_index < 64;
+	     string_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		string[ string_index ] = (char) ( '0' + ( ( value >> 16 ) % 10 ) );
+	}
+	/* Compare every string offset and string length up to 19 digits, which cannot
+	 * overflow, with a conversion one digit at a time to cover the 8 digit blocks
+	 * and the remaining digits
+	 */
+	for( string_offset = 0;
+	     string_offset < 45;
+	     string_offset++ )
+	{
+		for( string_length = 1;
+		     string_length <= 19;
+		     string_length++ )
+		{
+			expected_value = 0;
+
+			for( string_index = string_offset;
+			     string_index < ( string_offset + string_length );
+			     string_index++ )
+			{
+				expected_value = ( expected_value * 10 ) + (uint64_t) ( string[ string_index ] - '0' );
+			}
+			result = libcsplit_field_decoder_decode_uint64(
+			          &( string[ string_offset ] ),
+			          string_length,
+			          &value_64bit,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+			 "value_64bit",
+			 value_64bit,
+			 expected_value );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test a non-digit character at every position, including the characters
+	 * directly before and after the digits
+	 */
+	for( string_index = 0;
+	     string_index < 16;
+	     string_index++ )
+	{
+		memory_copy(
+		 string,
+		 "1234567890123456",
+		 16 );
+
+		string[ string_index ] = ( ( string_index % 2 ) == 0 ) ? '/' : ':';
+
+		result = libcsplit_field_decoder_decode_uint64(
+		          string,
+		          16,
+		          &value_64bit,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test the maximum value
+	 */
+	result = libcsplit_field_decoder_decode_uint64(
+	          "18446744073709551615",
+	          20,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) UINT64_MAX );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_field_decoder_decode_uint64(
+	          "18446744073709551616",
+	          20,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_uint64(
+	          "99999999999999999999",
+	          20,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_uint64(
+	          NULL,
+	          1,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_uint64(
+	          "1",
+	          0,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_uint64(
+	          "000000000000000000001",
+	          21,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_uint64(
+	          "1",
+	          1,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_int64 function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_int64(
+     void )
+{
+	const char *invalid_strings[ 5 ] = {
+		"", "-", "+-1", "9223372036854775808", "-9223372036854775809" };
+	const char *strings[ 5 ]         = {
+		"0", "+42", "-42", "9223372036854775807", "-9223372036854775808" };
+	int64_t expected_values[ 5 ]     = {
+		0, 42, -42, INT64_MAX, -INT64_MAX - 1 };
+
+	libcerror_error_t *error = NULL;
+	int64_t value_64bit      = 0;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_int64(
+		          strings[ string_index ],
+		          narrow_string_length( strings[ string_index ] ),
+		          &value_64bit,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ string_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_int64(
+		          invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          &value_64bit,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcsplit_field_decoder_decode_int64(
+	          NULL,
+	          1,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_int64(
+	          "1",
+	          1,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_hexadecimal function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_hexadecimal(
+     void )
+{
+	const char *invalid_strings[ 5 ] = {
+		"", "0x", "0xg", "-1", "10000000000000000" };
+	const char *strings[ 4 ]         = {
+		"0", "0xDEADbeef", "0X7f", "ffffffffffffffff" };
+	uint64_t expected_values[ 4 ]    = {
+		0, 0xdeadbeefUL, 0x7fUL, UINT64_MAX };
+
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 4;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_hexadecimal(
+		          strings[ string_index ],
+		          narrow_string_length( strings[ string_index ] ),
+		          &value_64bit,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 expected_values[ string_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_hexadecimal(
+		          invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          &value_64bit,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcsplit_field_decoder_decode_hexadecimal(
+	          NULL,
+	          1,
+	          &value_64bit,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_hexadecimal(
+	          "1",
+	          1,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_double function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_double(
+     void )
+{
+	const char *invalid_strings[ 7 ] = {
+		"", ".", "-", "1e", "1.2.3", "inf", "0x10" };
+	const char *strings[ 18 ]        = {
+		"0", "-0.0", "1.5", "-12.5e-3", "0.1", "3.141592653589793", "1e22", ".5",
+		"123456789012345678901234567890", "1e-300", "2.2250738585072011e-308",
+		"4.9406564584124654e-324", "1.7976931348623157e308", "9007199254740993",
+		"9007199254740993.00000000000000000001", "0.000000000000000000000000000000123456789",
+		"1e-400", "-2.5e-10" };
+	double expected_values[ 18 ]     = {
+		0.0, -0.0, 1.5, -12.5e-3, 0.1, 3.141592653589793, 1e22, 0.5,
+		123456789012345678901234567890.0, 1e-300, 2.2250738585072011e-308,
+		4.9406564584124654e-324, 1.7976931348623157e308, 9007199254740992.0,
+		9007199254740994.0, 0.000000000000000000000000000000123456789,
+		0.0, -2.5e-10 };
+
+	libcerror_error_t *error = NULL;
+	double value_double      = 0.0;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases, the values from the ninth are not exactly representable
+	 * with a mantissa of 53 bits and a power of 10 up to 22 and include denormalized
+	 * values and values halfway between 2 doubles
+	 */
+	for( string_index = 0;
+	     string_index < 18;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_double(
+		          strings[ string_index ],
+		          narrow_string_length( strings[ string_index ] ),
+		          &value_double,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_FLOAT(
+		 "value_double",
+		 value_double,
+		 expected_values[ string_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( string_index = 0;
+	     string_index < 7;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_double(
+		          invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          &value_double,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcsplit_field_decoder_decode_double(
+	          NULL,
+	          1,
+	          &value_double,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_double(
+	          "1",
+	          1,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_epoch_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_epoch_timestamp(
+     void )
+{
+	const char *invalid_strings[ 6 ] = {
+		"", "1.", ".5", "1.5x", "9223372036.854775808", "9223372037" };
+	const char *strings[ 5 ]         = {
+		"0", "1700000000.25", "-1.5", "1.0000000009", "9223372036.854775807" };
+	int64_t expected_values[ 5 ]     = {
+		0, 1700000000250000000L, -1500000000L, 1000000000L, INT64_MAX };
+
+	libcerror_error_t *error = NULL;
+	int64_t timestamp        = 0;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_epoch_timestamp(
+		          strings[ string_index ],
+		          narrow_string_length( strings[ string_index ] ),
+		          &timestamp,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT64(
+		 "timestamp",
+		 timestamp,
+		 expected_values[ string_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( string_index = 0;
+	     string_index < 6;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_epoch_timestamp(
+		          invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          &timestamp,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcsplit_field_decoder_decode_epoch_timestamp(
+	          NULL,
+	          1,
+	          &timestamp,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_epoch_timestamp(
+	          "1",
+	          1,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_iso8601_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_iso8601_timestamp(
+     void )
+{
+	const char *invalid_strings[ 12 ] = {
+		"2023/11/14", "2023-02-29", "2023-13-01", "2023-11-00", "2023-11-14X",
+		"2023-11-14T24:00", "2023-11-14T22:13:60", "2023-11-14T22:13:20.",
+		"2023-11-14T22:13:20+0", "2023-11-14T22:13:20Zx", "1677-09-21T00:12:43Z",
+		"2262-04-11T23:47:16.854775808Z" };
+	const char *strings[ 9 ]          = {
+		"1970-01-01", "2023-11-14T22:13:20Z", "2023-11-15T00:13:20+02:00",
+		"2023-11-14 17:13:20.5-0500", "2000-02-29T00:00", "1969-12-31T23:59:59.999999999Z",
+		"2023-11-14t22:13:20,25z", "1677-09-21T00:12:44Z", "2262-04-11T23:47:16.854775807Z" };
+	int64_t expected_values[ 9 ]      = {
+		0, 1700000000000000000L, 1700000000000000000L, 1700000000500000000L,
+		951782400000000000L, -1, 1700000000250000000L, -9223372036000000000L, INT64_MAX };
+
+	libcerror_error_t *error = NULL;
+	int64_t timestamp        = 0;
+	int result               = 0;
+	int string_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 9;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_iso8601_timestamp(
+		          strings[ string_index ],
+		          narrow_string_length( strings[ string_index ] ),
+		          &timestamp,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT64(
+		 "timestamp",
+		 timestamp,
+		 expected_values[ string_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	for( string_index = 0;
+	     string_index < 12;
+	     string_index++ )
+	{
+		result = libcsplit_field_decoder_decode_iso8601_timestamp(
+		          invalid_strings[ string_index ],
+		          narrow_string_length( invalid_strings[ string_index ] ),
+		          &timestamp,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcsplit_field_decoder_decode_iso8601_timestamp(
+	          NULL,
+	          10,
+	          &timestamp,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_iso8601_timestamp(
+	          "1970-01-01",
+	          10,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_field_decoder_decode_value function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_field_decoder_decode_value(
+     void )
+{
+	uint8_t value_data[ 9 ];
+
+	libcerror_error_t *error = NULL;
+	double value_double      = 0.0;
+	uint64_t value_64bit     = 0;
+	int64_t signed_value     = 0;
+	int result               = 0;
+
+	/* Test regular cases, the value data does not need to be aligned
+	 */
+	result = libcsplit_field_decoder_decode_value(
+	          "-5",
+	          2,
+	          LIBCSPLIT_FIELD_TYPE_INT64,
+	          &( value_data[ 1 ] ),
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &signed_value,
+	 &( value_data[ 1 ] ),
+	 sizeof( int64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "signed_value",
+	 signed_value,
+	 (int64_t) -5 );
+
+	result = libcsplit_field_decoder_decode_value(
+	          "a0",
+	          2,
+	          LIBCSPLIT_FIELD_TYPE_HEXADECIMAL,
+	          &( value_data[ 1 ] ),
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value_64bit,
+	 &( value_data[ 1 ] ),
+	 sizeof( uint64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xa0UL );
+
+	result = libcsplit_field_decoder_decode_value(
+	          "2.25",
+	          4,
+	          LIBCSPLIT_FIELD_TYPE_DOUBLE,
+	          &( value_data[ 1 ] ),
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &value_double,
+	 &( value_data[ 1 ] ),
+	 sizeof( double ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_double",
+	 value_double,
+	 2.25 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_field_decoder_decode_value(
+	          "x",
+	          1,
+	          LIBCSPLIT_FIELD_TYPE_UINT64,
+	          value_data,
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_value(
+	          "1",
+	          1,
+	          0xff,
+	          value_data,
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_value(
+	          "1",
+	          1,
+	          LIBCSPLIT_FIELD_TYPE_UINT64,
+	          NULL,
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_field_decoder_decode_value(
+	          "1",
+	          1,
+	          LIBCSPLIT_FIELD_TYPE_UINT64,
+	          value_data,
+	          7,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_uint64",
+	 csplit_test_field_decoder_decode_uint64 );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_int64",
+	 csplit_test_field_decoder_decode_int64 );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_hexadecimal",
+	 csplit_test_field_decoder_decode_hexadecimal );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_double",
+	 csplit_test_field_decoder_decode_double );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_epoch_timestamp",
+	 csplit_test_field_decoder_decode_epoch_timestamp );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_iso8601_timestamp",
+	 csplit_test_field_decoder_decode_iso8601_timestamp );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_field_decoder_decode_value",
+	 csplit_test_field_decoder_decode_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Functions for testing
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "csplit_test_functions.h"
+
+/* Writes data to a file, the file is created or truncated
+ * Returns 1 if successful or -1 on error
+ */
+int csplit_test_write_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size )
+{
+	FILE *file_stream  = NULL;
+	size_t write_count = 0;
+
+	if( filename == NULL )
+	{
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               file_stream,
+		               data,
+		               data_size );
+
+		if( write_count != data_size )
+		{
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a file
+ * Returns 1 if successful or -1 on error
+ */
+int csplit_test_remove_file(
+     const char *filename )
+{
+	if( filename == NULL )
+	{
+		return( -1 );
+	}
+	if( remove(
+	     filename ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
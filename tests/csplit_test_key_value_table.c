@@ -0,0 +1,777 @@
+/*
+ * Library key_value_table type test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#define CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS	40
+
+/* Creates a key value table with CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS
+ * keys "key#" with values "value#", followed by a duplicate of "key1"
+ * Returns 1 if successful or -1 on error
+ */
+int csplit_test_key_value_table_create(
+     libcsplit_key_value_table_t **key_value_table,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	char string[ 1024 ];
+
+	size_t string_length = 0;
+	int key_index        = 0;
+	int print_count      = 0;
+
+	for( key_index = 0;
+	     key_index < CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS;
+	     key_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               &( string[ string_length ] ),
+		               1024 - string_length,
+		               "key%d=value%d&",
+		               key_index,
+		               key_index );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= ( 1024 - string_length ) ) )
+		{
+			return( -1 );
+		}
+		string_length += (size_t) print_count;
+	}
+	print_count = narrow_string_snprintf(
+	               &( string[ string_length ] ),
+	               1024 - string_length,
+	               "key1=duplicate" );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= ( 1024 - string_length ) ) )
+	{
+		return( -1 );
+	}
+	string_length += (size_t) print_count;
+
+	return( libcsplit_narrow_string_split_key_values(
+	         string,
+	         string_length + 1,
+	         '&',
+	         '=',
+	         flags,
+	         key_value_table,
+	         error ) );
+}
+
+/* Tests the libcsplit_key_value_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_key_value_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcsplit_key_value_table_free(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_key_value_table_get_number_of_pairs function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_key_value_table_get_number_of_pairs(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcsplit_key_value_table_t *key_value_table = NULL;
+	int number_of_pairs                          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_key_value_table_create(
+	          &key_value_table,
+	          0,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "key_value_table",
+	 key_value_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_key_value_table_get_number_of_pairs(
+	          key_value_table,
+	          &number_of_pairs,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pairs",
+	 number_of_pairs,
+	 CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS + 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_key_value_table_get_number_of_pairs(
+	          NULL,
+	          &number_of_pairs,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_key_value_table_get_number_of_pairs(
+	          key_value_table,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_key_value_table_free(
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "key_value_table",
+	 key_value_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_value_table != NULL )
+	{
+		libcsplit_key_value_table_free(
+		 &key_value_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_key_value_table_get_pair_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_key_value_table_get_pair_by_index(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcsplit_key_value_table_t *key_value_table = NULL;
+	char *key                                    = NULL;
+	char *value                                  = NULL;
+	size_t key_size                              = 0;
+	size_t value_size                            = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_key_value_table_create(
+	          &key_value_table,
+	          0,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "key_value_table",
+	 key_value_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          key_value_table,
+	          CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS,
+	          &key,
+	          &key_size,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "key_size",
+	 key_size,
+	 (size_t) 5 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 10 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key,
+	          "key1",
+	          5 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          value,
+	          "duplicate",
+	          10 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          NULL,
+	          0,
+	          &key,
+	          &key_size,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          key_value_table,
+	          -1,
+	          &key,
+	          &key_size,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          key_value_table,
+	          CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS + 1,
+	          &key,
+	          &key_size,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          key_value_table,
+	          0,
+	          NULL,
+	          &key_size,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_key_value_table_get_pair_by_index(
+	          key_value_table,
+	          0,
+	          &key,
+	          &key_size,
+	          &value,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_key_value_table_free(
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_value_table != NULL )
+	{
+		libcsplit_key_value_table_free(
+		 &key_value_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_key_value_table_get_value_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_key_value_table_get_value_by_key(
+     void )
+{
+	char expected_value[ 16 ];
+	char key[ 16 ];
+
+	libcerror_error_t *error                     = NULL;
+	libcsplit_key_value_table_t *key_value_table = NULL;
+	char *value                                  = NULL;
+	size_t value_size                            = 0;
+	uint8_t flags                                = 0;
+	int key_index                                = 0;
+	int key_length                               = 0;
+	int result                                   = 0;
+
+	/* Test regular cases without and with a hash index
+	 */
+	for( flags = 0;
+	     flags <= LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX;
+	     flags++ )
+	{
+		result = csplit_test_key_value_table_create(
+		          &key_value_table,
+		          flags,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "key_value_table",
+		 key_value_table );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The value of the first pair with a duplicate key is retrieved
+		 */
+		for( key_index = 0;
+		     key_index < CSPLIT_TEST_KEY_VALUE_TABLE_NUMBER_OF_KEYS;
+		     key_index++ )
+		{
+			key_length = narrow_string_snprintf(
+			              key,
+			              16,
+			              "key%d",
+			              key_index );
+
+			narrow_string_snprintf(
+			 expected_value,
+			 16,
+			 "value%d",
+			 key_index );
+
+			result = libcsplit_key_value_table_get_value_by_key(
+			          key_value_table,
+			          key,
+			          (size_t) key_length,
+			          &value,
+			          &value_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "value_size",
+			 value_size,
+			 narrow_string_length( expected_value ) + 1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          value,
+			          expected_value,
+			          value_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* The key does not need to be terminated
+		 */
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          "key12345",
+		          5,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "value_size",
+		 value_size,
+		 (size_t) 8 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          "key",
+		          3,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          "key40",
+		          5,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          "",
+		          0,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		result = libcsplit_key_value_table_get_value_by_key(
+		          NULL,
+		          "key1",
+		          4,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          NULL,
+		          4,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libcsplit_key_value_table_get_value_by_key(
+		          key_value_table,
+		          "key1",
+		          4,
+		          NULL,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up
+		 */
+		result = libcsplit_key_value_table_free(
+		          &key_value_table,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_value_table != NULL )
+	{
+		libcsplit_key_value_table_free(
+		 &key_value_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_key_value_table_free",
+	 csplit_test_key_value_table_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_key_value_table_get_number_of_pairs",
+	 csplit_test_key_value_table_get_number_of_pairs );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_key_value_table_get_pair_by_index",
+	 csplit_test_key_value_table_get_pair_by_index );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_key_value_table_get_value_by_key",
+	 csplit_test_key_value_table_get_value_by_key );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,435 @@
+/*
+ * Library narrow file functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_functions.h"
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#define CSPLIT_TEST_NARROW_FILE_FILENAME	"csplit_test_narrow_file.tmp"
+
+/* Tests the libcsplit_narrow_file_split function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_file_split(
+     void )
+{
+	const char *expected_segments[ 5 ]            = { "ab", "c", "", "def", "" };
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string                                  = NULL;
+	char *string_segment                          = NULL;
+	size_t expected_segment_size                  = 0;
+	size_t string_segment_size                    = 0;
+	size_t string_size                            = 0;
+	uint8_t flags                                 = 0;
+	int file_created                              = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 4;
+	int test_number                               = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          (uint8_t *) "ab,c,,def,",
+	          10 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_file_split(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_string(
+	          split_string,
+	          &string,
+	          &string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 10 );
+
+	result = libcsplit_narrow_split_string_get_flags(
+	          split_string,
+	          &flags,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 ( LIBCSPLIT_SPLIT_STRING_FLAG_UNTERMINATED | LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY ) );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 5 );
+
+	for( segment_index = 0;
+	     segment_index < 5;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The segments reference the mapped file and are not terminated
+		 */
+		expected_segment_size = narrow_string_length(
+		                         expected_segments[ segment_index ] );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 expected_segment_size );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          expected_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_file_split(
+	          NULL,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_file_split(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          ',',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	split_string = (libcsplit_narrow_split_string_t *) 0x12345678UL;
+
+	result = libcsplit_narrow_file_split(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          ',',
+	          &split_string,
+	          &error );
+
+	split_string = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_narrow_file_split with malloc failing
+		 */
+		csplit_test_malloc_attempts_before_fail = test_number;
+
+		result = libcsplit_narrow_file_split(
+		          CSPLIT_TEST_NARROW_FILE_FILENAME,
+		          ',',
+		          &split_string,
+		          &error );
+
+		if( csplit_test_malloc_attempts_before_fail != -1 )
+		{
+			csplit_test_malloc_attempts_before_fail = -1;
+
+			if( split_string != NULL )
+			{
+				libcsplit_narrow_split_string_free(
+				 &split_string,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "split_string",
+			 split_string );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the file does not exist
+	 */
+	result = libcsplit_narrow_file_split(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular case where the file is empty
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          NULL,
+	          0 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	result = libcsplit_narrow_file_split(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_NARROW_FILE_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_NARROW_FILE_FILENAME );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_file_split",
+	 csplit_test_narrow_file_split );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,598 @@
+/*
+ * Library narrow_record_reader type test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_functions.h"
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#define CSPLIT_TEST_NARROW_RECORD_READER_FILENAME	"csplit_test_narrow_record_reader.tmp"
+
+/* Tests the libcsplit_narrow_record_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_record_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libcsplit_narrow_record_reader_t *record_reader = NULL;
+	FILE *stream                                    = NULL;
+	int file_created                                = 0;
+	int result                                      = 0;
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 4;
+	int test_number                                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME,
+	          NULL,
+	          0 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	stream = file_stream_open(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME,
+	          FILE_STREAM_BINARY_OPEN_READ );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_record_reader_initialize(
+	          &record_reader,
+	          stream,
+	          '\n',
+	          4096,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_reader",
+	 record_reader );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_record_reader_free(
+	          &record_reader,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "record_reader",
+	 record_reader );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_record_reader_initialize(
+	          NULL,
+	          stream,
+	          '\n',
+	          4096,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_reader = (libcsplit_narrow_record_reader_t *) 0x12345678UL;
+
+	result = libcsplit_narrow_record_reader_initialize(
+	          &record_reader,
+	          stream,
+	          '\n',
+	          4096,
+	          &error );
+
+	record_reader = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_record_reader_initialize(
+	          &record_reader,
+	          NULL,
+	          '\n',
+	          4096,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_record_reader_initialize(
+	          &record_reader,
+	          stream,
+	          '\n',
+	          0,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_narrow_record_reader_initialize with malloc failing
+		 */
+		csplit_test_malloc_attempts_before_fail = test_number;
+
+		result = libcsplit_narrow_record_reader_initialize(
+		          &record_reader,
+		          stream,
+		          '\n',
+		          4096,
+		          &error );
+
+		if( csplit_test_malloc_attempts_before_fail != -1 )
+		{
+			csplit_test_malloc_attempts_before_fail = -1;
+
+			if( record_reader != NULL )
+			{
+				libcsplit_narrow_record_reader_free(
+				 &record_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "record_reader",
+			 record_reader );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_reader != NULL )
+	{
+		libcsplit_narrow_record_reader_free(
+		 &record_reader,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_NARROW_RECORD_READER_FILENAME );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_record_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_record_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_record_reader_free(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_record_reader_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_record_reader_get_next_record(
+     void )
+{
+	const char *expected_records[ 5 ]               = { "first", "", "a record that spans several blocks", "x", "last" };
+	libcerror_error_t *error                        = NULL;
+	libcsplit_narrow_record_reader_t *record_reader = NULL;
+	FILE *stream                                    = NULL;
+	const char *record                              = NULL;
+	size_t expected_record_size                     = 0;
+	size_t record_size                              = 0;
+	int file_created                                = 0;
+	int record_index                                = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME,
+	          (uint8_t *) "first\n\na record that spans several blocks\nx\nlast",
+	          48 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	stream = file_stream_open(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME,
+	          FILE_STREAM_BINARY_OPEN_READ );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Use a small block size so that records straddle blocks
+	 */
+	result = libcsplit_narrow_record_reader_initialize(
+	          &record_reader,
+	          stream,
+	          '\n',
+	          8,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     record_index < 5;
+	     record_index++ )
+	{
+		result = libcsplit_narrow_record_reader_get_next_record(
+		          record_reader,
+		          &record,
+		          &record_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_record_size = narrow_string_length(
+		                        expected_records[ record_index ] );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "record_size",
+		 record_size,
+		 expected_record_size );
+
+		result = memory_compare(
+		          record,
+		          expected_records[ record_index ],
+		          expected_record_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_record_reader_get_next_record(
+	          record_reader,
+	          &record,
+	          &record_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_record_reader_get_next_record(
+	          NULL,
+	          &record,
+	          &record_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_record_reader_get_next_record(
+	          record_reader,
+	          NULL,
+	          &record_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_record_reader_get_next_record(
+	          record_reader,
+	          &record,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_record_reader_free(
+	          &record_reader,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_NARROW_RECORD_READER_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_reader != NULL )
+	{
+		libcsplit_narrow_record_reader_free(
+		 &record_reader,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_NARROW_RECORD_READER_FILENAME );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_record_reader_initialize",
+	 csplit_test_narrow_record_reader_initialize );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_record_reader_free",
+	 csplit_test_narrow_record_reader_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_record_reader_get_next_record",
+	 csplit_test_narrow_record_reader_get_next_record );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
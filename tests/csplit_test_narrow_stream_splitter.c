@@ -0,0 +1,871 @@
+/*
+ * Library narrow_stream_splitter type test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+/* Tests the libcsplit_narrow_stream_splitter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_stream_splitter_initialize(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libcsplit_narrow_stream_splitter_t *stream_splitter = NULL;
+	int result                                          = 0;
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                     = 2;
+	int number_of_memset_fail_tests                     = 1;
+	int test_number                                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_splitter",
+	 stream_splitter );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_stream_splitter_free(
+	          &stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "stream_splitter",
+	 stream_splitter );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          NULL,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_splitter = (libcsplit_narrow_stream_splitter_t *) 0x12345678UL;
+
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	stream_splitter = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_narrow_stream_splitter_initialize with malloc failing
+		 */
+		csplit_test_malloc_attempts_before_fail = test_number;
+
+		result = libcsplit_narrow_stream_splitter_initialize(
+		          &stream_splitter,
+		          ',',
+		          &error );
+
+		if( csplit_test_malloc_attempts_before_fail != -1 )
+		{
+			csplit_test_malloc_attempts_before_fail = -1;
+
+			if( stream_splitter != NULL )
+			{
+				libcsplit_narrow_stream_splitter_free(
+				 &stream_splitter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "stream_splitter",
+			 stream_splitter );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_narrow_stream_splitter_initialize with memset failing
+		 */
+		csplit_test_memset_attempts_before_fail = test_number;
+
+		result = libcsplit_narrow_stream_splitter_initialize(
+		          &stream_splitter,
+		          ',',
+		          &error );
+
+		if( csplit_test_memset_attempts_before_fail != -1 )
+		{
+			csplit_test_memset_attempts_before_fail = -1;
+
+			if( stream_splitter != NULL )
+			{
+				libcsplit_narrow_stream_splitter_free(
+				 &stream_splitter,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "stream_splitter",
+			 stream_splitter );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_splitter != NULL )
+	{
+		libcsplit_narrow_stream_splitter_free(
+		 &stream_splitter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_stream_splitter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_stream_splitter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_free(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_stream_splitter_get_next_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_stream_splitter_get_next_segment(
+     void )
+{
+	const char *chunks[ 4 ]                             = { "ab,c", "de,,f", "", "g" };
+	const char *expected_segments[ 4 ]                  = { "ab", "cde", "", "fg" };
+	size_t chunk_sizes[ 4 ]                             = { 4, 5, 0, 1 };
+	libcerror_error_t *error                            = NULL;
+	libcsplit_narrow_stream_splitter_t *stream_splitter = NULL;
+	const char *string_segment                          = NULL;
+	size_t string_segment_size                          = 0;
+	int chunk_index                                     = 0;
+	int number_of_segments                              = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_splitter",
+	 stream_splitter );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( chunk_index = 0;
+	     chunk_index < 4;
+	     chunk_index++ )
+	{
+		result = libcsplit_narrow_stream_splitter_feed(
+		          stream_splitter,
+		          chunks[ chunk_index ],
+		          chunk_sizes[ chunk_index ],
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		while( number_of_segments < 4 )
+		{
+			result = libcsplit_narrow_stream_splitter_get_next_segment(
+			          stream_splitter,
+			          &string_segment,
+			          &string_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result == 0 )
+			{
+				break;
+			}
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "string_segment_size",
+			 string_segment_size,
+			 narrow_string_length( expected_segments[ number_of_segments ] ) );
+
+			result = memory_compare(
+			          string_segment,
+			          expected_segments[ number_of_segments ],
+			          string_segment_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* The first segment does not straddle a chunk boundary and is not copied
+			 */
+			if( number_of_segments == 0 )
+			{
+				CSPLIT_TEST_ASSERT_EQUAL_INTPTR(
+				 "string_segment",
+				 (intptr_t) string_segment,
+				 (intptr_t) chunks[ 0 ] );
+			}
+			number_of_segments++;
+		}
+	}
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	result = libcsplit_narrow_stream_splitter_finish(
+	          stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          stream_splitter,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          string_segment,
+	          expected_segments[ 3 ],
+	          2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          stream_splitter,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          NULL,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          stream_splitter,
+	          NULL,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          stream_splitter,
+	          &string_segment,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test feed after finish
+	 */
+	result = libcsplit_narrow_stream_splitter_feed(
+	          stream_splitter,
+	          "abc",
+	          3,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_stream_splitter_free(
+	          &stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_splitter != NULL )
+	{
+		libcsplit_narrow_stream_splitter_free(
+		 &stream_splitter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_stream_splitter_feed function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_stream_splitter_feed(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libcsplit_narrow_stream_splitter_t *stream_splitter = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_stream_splitter_feed(
+	          stream_splitter,
+	          "a,b",
+	          3,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_feed(
+	          NULL,
+	          "a,b",
+	          3,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test feed with a previous chunk that was not consumed
+	 */
+	result = libcsplit_narrow_stream_splitter_feed(
+	          stream_splitter,
+	          "a,b",
+	          3,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_stream_splitter_free(
+	          &stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_feed(
+	          stream_splitter,
+	          NULL,
+	          3,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_stream_splitter_feed(
+	          stream_splitter,
+	          "a,b",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_stream_splitter_free(
+	          &stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_splitter != NULL )
+	{
+		libcsplit_narrow_stream_splitter_free(
+		 &stream_splitter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_stream_splitter_finish function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_stream_splitter_finish(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libcsplit_narrow_stream_splitter_t *stream_splitter = NULL;
+	const char *string_segment                          = NULL;
+	size_t string_segment_size                          = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcsplit_narrow_stream_splitter_initialize(
+	          &stream_splitter,
+	          ',',
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_stream_splitter_finish(
+	          stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Empty input has no segments
+	 */
+	result = libcsplit_narrow_stream_splitter_get_next_segment(
+	          stream_splitter,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_stream_splitter_finish(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_narrow_stream_splitter_free(
+	          &stream_splitter,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_splitter != NULL )
+	{
+		libcsplit_narrow_stream_splitter_free(
+		 &stream_splitter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_stream_splitter_initialize",
+	 csplit_test_narrow_stream_splitter_initialize );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_stream_splitter_free",
+	 csplit_test_narrow_stream_splitter_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_stream_splitter_feed",
+	 csplit_test_narrow_stream_splitter_feed );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_stream_splitter_finish",
+	 csplit_test_narrow_stream_splitter_finish );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_stream_splitter_get_next_segment",
+	 csplit_test_narrow_stream_splitter_get_next_segment );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
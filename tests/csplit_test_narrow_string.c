@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -41,6 +43,9 @@ int csplit_test_narrow_string_split(
 {
 	libcerror_error_t *error                      = NULL;
 	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
 	int result                                    = 0;
 
 	/* Test regular cases
@@ -125,6 +130,92 @@ int csplit_test_narrow_string_split(
 	 "error",
 	 error );
 
+	/* Test a string with characters after an end-of-string character
+	 * the last segment runs up to the last character of the string
+	 */
+	result = libcsplit_narrow_string_split(
+	          "a,b\0c",
+	          6,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "b\0c",
+	          sizeof( char ) * 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test empty string
 	 */
 	result = libcsplit_narrow_string_split(
@@ -316,24 +407,4019 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libcsplit_narrow_string_split_binary function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#endif
+int csplit_test_narrow_string_split_binary(
+     void )
 {
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+	size_t expected_segment_offsets[ 4 ] = { 0, 4, 5, 8 };
+	size_t expected_segment_sizes[ 4 ]   = { 3, 0, 2, 0 };
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_narrow_string_split",
-	 csplit_test_narrow_string_split );
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_table_t *segment_table = NULL;
+	size_t segment_offset                    = 0;
+	size_t segment_size                      = 0;
+	int number_of_segments                   = 0;
+	int result                               = 0;
+	int segment_index                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_binary(
+	          "a\0b,,c\0,",
+	          8,
+	          (char) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_segment_table_get_segment_by_index(
+		          segment_table,
+		          segment_index,
+		          &segment_offset,
+		          &segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_offset",
+		 segment_offset,
+		 expected_segment_offsets[ segment_index ] );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_size",
+		 segment_size,
+		 expected_segment_sizes[ segment_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcsplit_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_narrow_string_split_binary(
+	          "a\0b,,c\0,",
+	          0,
+	          (char) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_binary(
+	          NULL,
+	          8,
+	          (char) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_binary(
+	          "a\0b,,c\0,",
+	          8,
+	          (char) ',',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libcsplit_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_escaped function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_escaped(
+     void )
+{
+	const char *expected_escaped_segments[ 3 ]   = { "a\\:b", "c\\\\", "d\\" };
+	const char *expected_unescaped_segments[ 3 ] = { "a:b", "c\\", "d\\" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	const char **expected_segments                = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	uint8_t flags                                 = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	for( flags = 0;
+	     flags <= LIBCSPLIT_ESCAPE_FLAG_UNESCAPE;
+	     flags++ )
+	{
+		if( flags == 0 )
+		{
+			expected_segments = expected_escaped_segments;
+		}
+		else
+		{
+			expected_segments = expected_unescaped_segments;
+		}
+		result = libcsplit_narrow_string_split_escaped(
+		          "a\\:b:c\\\\:d\\",
+		          12,
+		          ':',
+		          '\\',
+		          flags,
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "split_string",
+		 split_string );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_narrow_split_string_get_number_of_segments(
+		          split_string,
+		          &number_of_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_segments",
+		 number_of_segments,
+		 3 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( segment_index = 0;
+		     segment_index < 3;
+		     segment_index++ )
+		{
+			result = libcsplit_narrow_split_string_get_segment_by_index(
+			          split_string,
+			          segment_index,
+			          &string_segment,
+			          &string_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "string_segment_size",
+			 string_segment_size,
+			 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          string_segment,
+			          expected_segments[ segment_index ],
+			          string_segment_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libcsplit_narrow_split_string_free(
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test an empty string
+	 */
+	result = libcsplit_narrow_string_split_escaped(
+	          "",
+	          1,
+	          ':',
+	          '\\',
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_escaped(
+	          NULL,
+	          12,
+	          ':',
+	          '\\',
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_escaped(
+	          "a:b",
+	          4,
+	          ':',
+	          ':',
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_escaped(
+	          "a:b",
+	          4,
+	          ':',
+	          '\\',
+	          0xff,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_escaped(
+	          "a:b",
+	          4,
+	          ':',
+	          '\\',
+	          0,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_fields function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_fields(
+     void )
+{
+	const char *expected_segments[ 3 ] = { "bb", "ccc", "" };
+	int duplicate_field_indexes[ 2 ]   = { 1, 1 };
+	int field_indexes[ 3 ]             = { 1, 3, 7 };
+	int unsorted_field_indexes[ 2 ]    = { 3, 1 };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string                                  = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	size_t string_size                            = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          field_indexes,
+	          3,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* The string is only copied up to the end of the last field
+	 */
+	result = libcsplit_narrow_split_string_get_string(
+	          split_string,
+	          &string,
+	          &string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 10 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string without delimiters
+	 */
+	result = libcsplit_narrow_string_split_fields(
+	          "ccc",
+	          4,
+	          ',',
+	          &( field_indexes[ 1 ] ),
+	          1,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          0,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string, every field is empty
+	 */
+	result = libcsplit_narrow_string_split_fields(
+	          "",
+	          1,
+	          ',',
+	          field_indexes,
+	          3,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 (size_t) 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string without an end-of-string character
+	 */
+	result = libcsplit_narrow_string_split_fields(
+	          "",
+	          0,
+	          ',',
+	          field_indexes,
+	          1,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_fields(
+	          NULL,
+	          12,
+	          ',',
+	          field_indexes,
+	          3,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          NULL,
+	          3,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          field_indexes,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          unsorted_field_indexes,
+	          2,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          duplicate_field_indexes,
+	          2,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          field_indexes,
+	          3,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	/* Test libcsplit_narrow_string_split_fields with malloc failing when copying the string
+	 */
+	csplit_test_malloc_attempts_before_fail = 4;
+
+	result = libcsplit_narrow_string_split_fields(
+	          "a,bb,,ccc,d",
+	          12,
+	          ',',
+	          field_indexes,
+	          3,
+	          &split_string,
+	          &error );
+
+	if( csplit_test_malloc_attempts_before_fail != -1 )
+	{
+		csplit_test_malloc_attempts_before_fail = -1;
+
+		if( split_string != NULL )
+		{
+			libcsplit_narrow_split_string_free(
+			 &split_string,
+			 NULL );
+		}
+	}
+	else
+	{
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "split_string",
+		 split_string );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_hierarchy function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_hierarchy(
+     void )
+{
+	size_t expected_segment_offsets[ 12 ] = { 0, 6, 8, 0, 4, 6, 8, 0, 2, 4, 6, 8 };
+	size_t expected_segment_sizes[ 12 ]   = { 5, 1, 0, 3, 1, 1, 0, 1, 1, 1, 1, 0 };
+	int expected_number_of_segments[ 3 ]  = { 3, 4, 5 };
+
+	libcerror_error_t *error                     = NULL;
+	libcsplit_split_hierarchy_t *split_hierarchy = NULL;
+	size_t segment_offset                        = 0;
+	size_t segment_size                          = 0;
+	int expected_index                           = 0;
+	int first_child_segment_index                = 0;
+	int level                                    = 0;
+	int number_of_child_segments                 = 0;
+	int number_of_levels                         = 0;
+	int number_of_segments                       = 0;
+	int result                                   = 0;
+	int segment_index                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          "\n\t,",
+	          3,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_hierarchy",
+	 split_hierarchy );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_split_hierarchy_get_number_of_levels(
+	          split_hierarchy,
+	          &number_of_levels,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_levels",
+	 number_of_levels,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( level = 0;
+	     level < 3;
+	     level++ )
+	{
+		result = libcsplit_split_hierarchy_get_number_of_segments(
+		          split_hierarchy,
+		          level,
+		          &number_of_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_segments",
+		 number_of_segments,
+		 expected_number_of_segments[ level ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			result = libcsplit_split_hierarchy_get_segment_by_index(
+			          split_hierarchy,
+			          level,
+			          segment_index,
+			          &segment_offset,
+			          &segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "segment_offset",
+			 segment_offset,
+			 expected_segment_offsets[ expected_index ] );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "segment_size",
+			 segment_size,
+			 expected_segment_sizes[ expected_index ] );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			expected_index++;
+		}
+	}
+	/* The first record contains the fields "a,b" and "c"
+	 */
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          0,
+	          0,
+	          &first_child_segment_index,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "first_child_segment_index",
+	 first_child_segment_index,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_child_segments",
+	 number_of_child_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second field contains the subfield "c"
+	 */
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          1,
+	          1,
+	          &first_child_segment_index,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "first_child_segment_index",
+	 first_child_segment_index,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_child_segments",
+	 number_of_child_segments,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_split_hierarchy_free(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "",
+	          1,
+	          "\n\t,",
+	          3,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_hierarchy",
+	 split_hierarchy );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_hierarchy(
+	          NULL,
+	          10,
+	          "\n\t,",
+	          3,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          NULL,
+	          3,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          "\n\t,",
+	          0,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          "\n\t,,,,,,,",
+	          9,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a delimiter that occurs more than once
+	 */
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          "\n\t\n",
+	          3,
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_hierarchy(
+	          "a,b\tc\nd\n",
+	          10,
+	          "\n\t,",
+	          3,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_hierarchy != NULL )
+	{
+		libcsplit_split_hierarchy_free(
+		 &split_hierarchy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_key_values function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_key_values(
+     void )
+{
+	const char *expected_keys[ 4 ]   = { "a", "bb", "c", "d" };
+	const char *expected_values[ 4 ] = { "1", "22", "", "x=y" };
+
+	libcerror_error_t *error                     = NULL;
+	libcsplit_key_value_table_t *key_value_table = NULL;
+	char *key                                    = NULL;
+	char *value                                  = NULL;
+	size_t key_size                              = 0;
+	size_t value_size                            = 0;
+	int number_of_pairs                          = 0;
+	int pair_index                               = 0;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_key_values(
+	          "a=1;bb=22;;c;d=x=y",
+	          19,
+	          ';',
+	          '=',
+	          0,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "key_value_table",
+	 key_value_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_key_value_table_get_number_of_pairs(
+	          key_value_table,
+	          &number_of_pairs,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pairs",
+	 number_of_pairs,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pair_index = 0;
+	     pair_index < 4;
+	     pair_index++ )
+	{
+		result = libcsplit_key_value_table_get_pair_by_index(
+		          key_value_table,
+		          pair_index,
+		          &key,
+		          &key_size,
+		          &value,
+		          &value_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "key_size",
+		 key_size,
+		 narrow_string_length( expected_keys[ pair_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "value_size",
+		 value_size,
+		 narrow_string_length( expected_values[ pair_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          key,
+		          expected_keys[ pair_index ],
+		          key_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          value,
+		          expected_values[ pair_index ],
+		          value_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_key_value_table_free(
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string with a hash index
+	 */
+	result = libcsplit_narrow_string_split_key_values(
+	          "session=abc; theme=dark",
+	          24,
+	          ';',
+	          '=',
+	          LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The space that follows the pair delimiter is part of the key
+	 */
+	result = libcsplit_key_value_table_get_value_by_key(
+	          key_value_table,
+	          " theme",
+	          6,
+	          &value,
+	          &value_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 5 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value,
+	          "dark",
+	          5 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_key_value_table_free(
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that only contains pair delimiters
+	 */
+	result = libcsplit_narrow_string_split_key_values(
+	          "&&&",
+	          4,
+	          '&',
+	          '=',
+	          LIBCSPLIT_KEY_VALUE_FLAG_HASH_INDEX,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "key_value_table",
+	 key_value_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_key_values(
+	          NULL,
+	          19,
+	          ';',
+	          '=',
+	          0,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_key_values(
+	          "a=1",
+	          4,
+	          '=',
+	          '=',
+	          0,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_key_values(
+	          "a=1",
+	          4,
+	          ';',
+	          '=',
+	          0xff,
+	          &key_value_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_key_values(
+	          "a=1",
+	          4,
+	          ';',
+	          '=',
+	          0,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_value_table != NULL )
+	{
+		libcsplit_key_value_table_free(
+		 &key_value_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_multi_string function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_multi_string(
+     void )
+{
+	const char *expected_segments[ 2 ] = { "one", "two" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_multi_string(
+	          "one\0two\0\0ignored",
+	          17,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 2;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a multi-string of which the last string is not terminated
+	 */
+	result = libcsplit_narrow_string_split_multi_string(
+	          "one\0two",
+	          8,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "two",
+	          4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty multi-string
+	 */
+	result = libcsplit_narrow_string_split_multi_string(
+	          "\0",
+	          2,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_multi_string(
+	          NULL,
+	          17,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_multi_string(
+	          "one\0two\0\0ignored",
+	          17,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_path function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_path(
+     void )
+{
+	const char *expected_segments[ 4 ]     = { "", "usr", "local", "bin" };
+	const char *expected_unc_segments[ 4 ] = { "", "server", "share", "x" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          "/usr//local/./lib/../bin/",
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a path with a drive letter and backslash separators
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          "C:\\Windows\\..\\..\\System32",
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 9 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "System32",
+	          9 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a relative path with unresolvable parent components
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          "../a/../../b",
+	          13,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "..",
+	          3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UNC path, ".." does not remove the server and share name
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          "\\\\server\\share\\..\\x",
+	          20,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_unc_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_unc_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test paths that normalize to no components, like an empty path these have no segments
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          "./a/..",
+	          7,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_string_split_path(
+	          "./.",
+	          4,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_path(
+	          NULL,
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_path(
+	          "/usr//local/./lib/../bin/",
+	          26,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_quoted function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_quoted(
+     void )
+{
+	const char *expected_segments[ 5 ] = { "a", "b,c", "d\"e", "", "x" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_quoted(
+	          "a,\"b,c\",\"d\"\"e\",,\"x\"",
+	          20,
+	          ',',
+	          '"',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 5 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 5;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a quoted field that spans multiple vector blocks
+	 */
+	result = libcsplit_narrow_string_split_quoted(
+	          "one\t\"two\tthree\tfour\tfive\tsix\tseven\teight\tnine\tten\televen\ttwelve\tthirteen\"\tfourteen",
+	          83,
+	          '\t',
+	          '"',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          2,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 9 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "fourteen",
+	          9 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_narrow_string_split_quoted(
+	          "",
+	          1,
+	          ',',
+	          '"',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_quoted(
+	          NULL,
+	          19,
+	          ',',
+	          '"',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_quoted(
+	          "a,b",
+	          4,
+	          ',',
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_quoted(
+	          "a,b",
+	          4,
+	          ',',
+	          '"',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a string with a missing closing quote
+	 */
+	result = libcsplit_narrow_string_split_quoted(
+	          "a,\"b,c",
+	          7,
+	          ',',
+	          '"',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_typed_fields function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_typed_fields(
+     void )
+{
+	uint8_t record_data[ 48 ];
+
+	size_t value_offsets[ 6 ]            = { 0, 8, 16, 24, 32, 40 };
+	uint8_t field_types[ 6 ]             = {
+		LIBCSPLIT_FIELD_TYPE_INT64,
+		LIBCSPLIT_FIELD_TYPE_HEXADECIMAL,
+		LIBCSPLIT_FIELD_TYPE_DOUBLE,
+		LIBCSPLIT_FIELD_TYPE_TIMESTAMP_ISO8601,
+		LIBCSPLIT_FIELD_TYPE_TIMESTAMP_EPOCH,
+		LIBCSPLIT_FIELD_TYPE_UINT64 };
+	uint8_t unsupported_field_types[ 1 ] = { 0 };
+	int field_indexes[ 6 ]               = { 1, 2, 3, 5, 6, 7 };
+	int missing_field_indexes[ 1 ]       = { 9 };
+	int unsorted_field_indexes[ 2 ]      = { 3, 1 };
+
+	libcerror_error_t *error = NULL;
+	const char *string       = "id,-7,ff00,-12.5,x,2023-11-14T22:13:20Z,1700000000.25,18446744073709551615,z";
+	double value_double      = 0.0;
+	uint64_t value_64bit     = 0;
+	int64_t signed_value     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 &signed_value,
+	 &( record_data[ 0 ] ),
+	 sizeof( int64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "signed_value",
+	 signed_value,
+	 (int64_t) -7 );
+
+	memory_copy(
+	 &value_64bit,
+	 &( record_data[ 8 ] ),
+	 sizeof( uint64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xff00UL );
+
+	memory_copy(
+	 &value_double,
+	 &( record_data[ 16 ] ),
+	 sizeof( double ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_FLOAT(
+	 "value_double",
+	 value_double,
+	 -12.5 );
+
+	memory_copy(
+	 &signed_value,
+	 &( record_data[ 24 ] ),
+	 sizeof( int64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "signed_value",
+	 signed_value,
+	 (int64_t) 1700000000000000000L );
+
+	memory_copy(
+	 &signed_value,
+	 &( record_data[ 32 ] ),
+	 sizeof( int64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT64(
+	 "signed_value",
+	 signed_value,
+	 (int64_t) 1700000000250000000L );
+
+	memory_copy(
+	 &value_64bit,
+	 &( record_data[ 40 ] ),
+	 sizeof( uint64_t ) );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) UINT64_MAX );
+
+	/* Test a string without a field with the field index
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          missing_field_indexes,
+	          field_types,
+	          value_offsets,
+	          1,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          "",
+	          1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          1,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a field value that cannot be decoded as the field type
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          &( field_indexes[ 3 ] ),
+	          field_types,
+	          value_offsets,
+	          1,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          NULL,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          (size_t) SSIZE_MAX + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          NULL,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          NULL,
+	          value_offsets,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          NULL,
+	          6,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          0,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          NULL,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          4,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value offset beyond the end of the record data
+	 */
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          field_types,
+	          value_offsets,
+	          6,
+	          record_data,
+	          44,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          unsorted_field_indexes,
+	          field_types,
+	          value_offsets,
+	          2,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_typed_fields(
+	          string,
+	          narrow_string_length( string ) + 1,
+	          ',',
+	          field_indexes,
+	          unsupported_field_types,
+	          value_offsets,
+	          1,
+	          record_data,
+	          48,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_whitespace function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_whitespace(
+     void )
+{
+	const char *expected_segments[ 3 ] = { "one", "two", "three" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_split_whitespace(
+	          "  one\ttwo \r\n three  ",
+	          21,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string with whitespace runs that span multiple vector blocks
+	 */
+	result = libcsplit_narrow_string_split_whitespace(
+	          "one                                                                  two\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\tthree",
+	          142,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          2,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 6 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "three",
+	          6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string that only contains whitespace
+	 */
+	result = libcsplit_narrow_string_split_whitespace(
+	          " \t\n ",
+	          5,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_whitespace(
+	          NULL,
+	          21,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_whitespace(
+	          "one two",
+	          8,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_split_with_options function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_split_with_options(
+     void )
+{
+	const char *expected_skipped_segments[ 2 ] = { "a", "b c" };
+	const char *expected_trimmed_segments[ 4 ] = { "a", "", "b c", "" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	const char **expected_segments                = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	uint8_t flags                                 = 0;
+	int expected_number_of_segments               = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	for( flags = 0;
+	     flags <= LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY;
+	     flags++ )
+	{
+		if( flags == 0 )
+		{
+			expected_segments           = expected_trimmed_segments;
+			expected_number_of_segments = 4;
+		}
+		else
+		{
+			expected_segments           = expected_skipped_segments;
+			expected_number_of_segments = 2;
+		}
+		result = libcsplit_narrow_string_split_with_options(
+		          " a , ,\tb c ,  ",
+		          15,
+		          (char) ',',
+		          flags,
+		          " \t",
+		          2,
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "split_string",
+		 split_string );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_narrow_split_string_get_number_of_segments(
+		          split_string,
+		          &number_of_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_segments",
+		 number_of_segments,
+		 expected_number_of_segments );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( segment_index = 0;
+		     segment_index < expected_number_of_segments;
+		     segment_index++ )
+		{
+			result = libcsplit_narrow_split_string_get_segment_by_index(
+			          split_string,
+			          segment_index,
+			          &string_segment,
+			          &string_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "string_segment_size",
+			 string_segment_size,
+			 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          string_segment,
+			          expected_segments[ segment_index ],
+			          string_segment_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libcsplit_narrow_split_string_free(
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a string of which all segments are skipped
+	 */
+	result = libcsplit_narrow_string_split_with_options(
+	          ",,,",
+	          4,
+	          (char) ',',
+	          LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_split_with_options(
+	          NULL,
+	          15,
+	          (char) ',',
+	          0,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_with_options(
+	          "a,b",
+	          4,
+	          (char) ',',
+	          0xff,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_with_options(
+	          "a,b",
+	          4,
+	          (char) ',',
+	          0,
+	          NULL,
+	          1,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_split_with_options(
+	          "a,b",
+	          4,
+	          (char) ',',
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_narrow_string_transcode_delimiters function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_narrow_string_transcode_delimiters(
+     void )
+{
+	char string[ 16 ];
+	char transcoded_string[ 16 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t transcoded_string_length = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 10 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          "\t\ta\t\tb\tc\t\t",
+	          11 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 7 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          "\ta\tb\tc\t",
+	          8 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 6 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          "a\t\tb\tc",
+	          7 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test transcoding in place
+	 */
+	memory_copy(
+	 string,
+	 ",,a,;b,c,,",
+	 11 );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          string,
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS | LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          string,
+	          11,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 5 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "a\tb\tc",
+	          6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a string only containing delimiters
+	 */
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,,",
+	          4,
+	          ",",
+	          1,
+	          ' ',
+	          LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          NULL,
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          NULL,
+	          2,
+	          '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          0xff,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          0,
+	          transcoded_string,
+	          4,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_narrow_string_transcode_delimiters(
+	          ",,a,;b,c,,",
+	          11,
+	          ",;",
+	          2,
+	          '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split",
+	 csplit_test_narrow_string_split );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_binary",
+	 csplit_test_narrow_string_split_binary );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_escaped",
+	 csplit_test_narrow_string_split_escaped );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_fields",
+	 csplit_test_narrow_string_split_fields );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_hierarchy",
+	 csplit_test_narrow_string_split_hierarchy );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_key_values",
+	 csplit_test_narrow_string_split_key_values );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_multi_string",
+	 csplit_test_narrow_string_split_multi_string );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_path",
+	 csplit_test_narrow_string_split_path );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_quoted",
+	 csplit_test_narrow_string_split_quoted );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_typed_fields",
+	 csplit_test_narrow_string_split_typed_fields );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_whitespace",
+	 csplit_test_narrow_string_split_whitespace );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_split_with_options",
+	 csplit_test_narrow_string_split_with_options );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_narrow_string_transcode_delimiters",
+	 csplit_test_narrow_string_transcode_delimiters );
 
 	return( EXIT_SUCCESS );
 
@@ -0,0 +1,1244 @@
+/*
+ * Library segment index functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_functions.h"
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#include "../libcsplit/libcsplit_varint.h"
+
+#define CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME		"csplit_test_segment_index.tmp"
+#define CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME	"csplit_test_segment_index.idx"
+
+#define CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE		65536
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+/* Tests the libcsplit_varint_encode and libcsplit_varint_decode functions
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_varint_encode_decode(
+     void )
+{
+	uint8_t byte_stream[ LIBCSPLIT_VARINT_MAXIMUM_SIZE ];
+
+	uint64_t values[ 6 ]       = { 0, 1, 127, 128, 16384, 0xffffffffffffffffULL };
+	size_t expected_sizes[ 6 ] = { 1, 1, 1, 2, 3, 10 };
+
+	libcerror_error_t *error   = NULL;
+	size_t decoded_size        = 0;
+	size_t encoded_size        = 0;
+	uint64_t value_64bit       = 0;
+	int result                 = 0;
+	int value_index            = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		result = libcsplit_varint_encode(
+		          values[ value_index ],
+		          byte_stream,
+		          LIBCSPLIT_VARINT_MAXIMUM_SIZE,
+		          &encoded_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "encoded_size",
+		 encoded_size,
+		 expected_sizes[ value_index ] );
+
+		result = libcsplit_varint_decode(
+		          byte_stream,
+		          encoded_size,
+		          &value_64bit,
+		          &decoded_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "decoded_size",
+		 decoded_size,
+		 encoded_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "value_64bit",
+		 value_64bit,
+		 values[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libcsplit_varint_encode(
+	          128,
+	          byte_stream,
+	          1,
+	          &encoded_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding a truncated variable-length integer
+	 */
+	byte_stream[ 0 ] = 0x80;
+
+	result = libcsplit_varint_decode(
+	          byte_stream,
+	          1,
+	          &value_64bit,
+	          &decoded_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decoding a variable-length integer that exceeds 64 bits
+	 */
+	for( value_index = 0;
+	     value_index < 9;
+	     value_index++ )
+	{
+		byte_stream[ value_index ] = 0xff;
+	}
+	byte_stream[ 9 ] = 0x02;
+
+	result = libcsplit_varint_decode(
+	          byte_stream,
+	          LIBCSPLIT_VARINT_MAXIMUM_SIZE,
+	          &value_64bit,
+	          &decoded_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_varint_decode(
+	          NULL,
+	          1,
+	          &value_64bit,
+	          &decoded_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+/* Tests the libcsplit_segment_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_segment_index_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_index_t *segment_index = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcsplit_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_index",
+	 segment_index );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_index",
+	 segment_index );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_segment_index_initialize(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segment_index = (libcsplit_segment_index_t *) 0x12345678UL;
+
+	result = libcsplit_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	segment_index = NULL;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CSPLIT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_segment_index_initialize with malloc failing
+		 */
+		csplit_test_malloc_attempts_before_fail = test_number;
+
+		result = libcsplit_segment_index_initialize(
+		          &segment_index,
+		          &error );
+
+		if( csplit_test_malloc_attempts_before_fail != -1 )
+		{
+			csplit_test_malloc_attempts_before_fail = -1;
+
+			if( segment_index != NULL )
+			{
+				libcsplit_segment_index_free(
+				 &segment_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "segment_index",
+			 segment_index );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcsplit_segment_index_initialize with memset failing
+		 */
+		csplit_test_memset_attempts_before_fail = test_number;
+
+		result = libcsplit_segment_index_initialize(
+		          &segment_index,
+		          &error );
+
+		if( csplit_test_memset_attempts_before_fail != -1 )
+		{
+			csplit_test_memset_attempts_before_fail = -1;
+
+			if( segment_index != NULL )
+			{
+				libcsplit_segment_index_free(
+				 &segment_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "segment_index",
+			 segment_index );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CSPLIT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_index != NULL )
+	{
+		libcsplit_segment_index_free(
+		 &segment_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_segment_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_segment_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcsplit_segment_index_free(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_segment_index_build function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_segment_index_build(
+     void )
+{
+	uint64_t expected_segment_offsets[ 5 ]   = { 0, 3, 5, 6, 10 };
+	uint64_t expected_segment_sizes[ 5 ]     = { 2, 1, 0, 3, 0 };
+
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_index_t *segment_index = NULL;
+	uint64_t number_of_segments              = 0;
+	uint64_t segment_number                  = 0;
+	uint64_t segment_offset                  = 0;
+	uint64_t segment_size                    = 0;
+	int file_created                         = 0;
+	int index_file_created                   = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          (uint8_t *) "ab,c,,def,",
+	          10 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	result = libcsplit_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          ',',
+	          3,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	index_file_created = 1;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_open(
+	          segment_index,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_get_number_of_segments(
+	          segment_index,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_segments",
+	 number_of_segments,
+	 (uint64_t) 5 );
+
+	for( segment_number = 0;
+	     segment_number < 5;
+	     segment_number++ )
+	{
+		result = libcsplit_segment_index_get_segment_by_index(
+		          segment_index,
+		          segment_number,
+		          &segment_offset,
+		          &segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_offset",
+		 segment_offset,
+		 expected_segment_offsets[ segment_number ] );
+
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_size",
+		 segment_size,
+		 expected_segment_sizes[ segment_number ] );
+	}
+	result = libcsplit_segment_index_close(
+	          segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_segment_index_build(
+	          NULL,
+	          ',',
+	          3,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          ',',
+	          0,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          ',',
+	          2,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the index file is not a segment index
+	 */
+	result = libcsplit_segment_index_open(
+	          segment_index,
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular case where the file is empty
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          NULL,
+	          0 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          ',',
+	          3,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_open(
+	          segment_index,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_get_number_of_segments(
+	          segment_index,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_segments",
+	 number_of_segments,
+	 (uint64_t) 0 );
+
+	result = libcsplit_segment_index_close(
+	          segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libcsplit_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	index_file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the file does not exist
+	 */
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          ',',
+	          3,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_index != NULL )
+	{
+		libcsplit_segment_index_free(
+		 &segment_index,
+		 NULL );
+	}
+	if( index_file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_segment_index_get_segment_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_segment_index_get_segment_by_index(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_index_t *segment_index = NULL;
+	uint64_t *segment_offsets                = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_offset                       = 0;
+	size_t segment_data_size                 = 0;
+	uint64_t expected_number_of_segments     = 0;
+	uint64_t expected_segment_size           = 0;
+	uint64_t number_of_segments              = 0;
+	uint64_t segment_number                  = 0;
+	uint64_t segment_offset                  = 0;
+	uint64_t segment_size                    = 0;
+	int file_created                         = 0;
+	int index_file_created                   = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 * The segment sizes vary so that the offset differences require multiple bytes to encode
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	segment_offsets = (uint64_t *) memory_allocate(
+	                                sizeof( uint64_t ) * ( CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE + 1 ) );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_offsets",
+	 segment_offsets );
+
+	segment_offsets[ 0 ] = 0;
+
+	while( data_offset < CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE )
+	{
+		segment_data_size = (size_t) ( ( expected_number_of_segments * 37 ) % 301 );
+
+		while( ( segment_data_size > 0 )
+		    && ( data_offset < CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE ) )
+		{
+			data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 26 ) );
+
+			data_offset++;
+			segment_data_size--;
+		}
+		if( data_offset < CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE )
+		{
+			data[ data_offset++ ] = (uint8_t) '\n';
+
+			segment_offsets[ ++expected_number_of_segments ] = (uint64_t) data_offset;
+		}
+	}
+	expected_number_of_segments += 1;
+
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          data,
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	result = libcsplit_segment_index_build(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME,
+	          '\n',
+	          7,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	index_file_created = 1;
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_initialize(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_segment_index_open(
+	          segment_index,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_index_get_number_of_segments(
+	          segment_index,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_segments",
+	 number_of_segments,
+	 expected_number_of_segments );
+
+	/* Test regular cases
+	 */
+	for( segment_number = 0;
+	     segment_number < number_of_segments;
+	     segment_number++ )
+	{
+		result = libcsplit_segment_index_get_segment_by_index(
+		          segment_index,
+		          segment_number,
+		          &segment_offset,
+		          &segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_offset",
+		 segment_offset,
+		 segment_offsets[ segment_number ] );
+
+		if( ( segment_number + 1 ) < number_of_segments )
+		{
+			expected_segment_size = segment_offsets[ segment_number + 1 ] - segment_offset - 1;
+		}
+		else
+		{
+			expected_segment_size = CSPLIT_TEST_SEGMENT_INDEX_DATA_SIZE - segment_offset;
+		}
+		CSPLIT_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_size",
+		 segment_size,
+		 expected_segment_size );
+	}
+	/* Test error cases
+	 */
+	result = libcsplit_segment_index_get_segment_by_index(
+	          NULL,
+	          0,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_get_segment_by_index(
+	          segment_index,
+	          number_of_segments,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_get_segment_by_index(
+	          segment_index,
+	          0,
+	          NULL,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_get_segment_by_index(
+	          segment_index,
+	          0,
+	          &segment_offset,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the segment index is already open
+	 */
+	result = libcsplit_segment_index_open(
+	          segment_index,
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_close(
+	          segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error case where the segment index is not open
+	 */
+	result = libcsplit_segment_index_get_segment_by_index(
+	          segment_index,
+	          0,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_index_close(
+	          segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_segment_index_free(
+	          &segment_index,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	index_file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 segment_offsets );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_index != NULL )
+	{
+		libcsplit_segment_index_free(
+		 &segment_index,
+		 NULL );
+	}
+	if( index_file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_SEGMENT_INDEX_INDEX_FILENAME );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_SEGMENT_INDEX_DATA_FILENAME );
+	}
+	if( segment_offsets != NULL )
+	{
+		memory_free(
+		 segment_offsets );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_varint_encode_decode",
+	 csplit_test_varint_encode_decode );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_segment_index_initialize",
+	 csplit_test_segment_index_initialize );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_segment_index_free",
+	 csplit_test_segment_index_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_segment_index_build",
+	 csplit_test_segment_index_build );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_segment_index_get_segment_by_index",
+	 csplit_test_segment_index_get_segment_by_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
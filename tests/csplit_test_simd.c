@@ -0,0 +1,1157 @@
+/*
+ * Library SIMD functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#include "../libcsplit/libcsplit_simd.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+/* Tests the libcsplit_simd_search_uint16 function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_uint16(
+     void )
+{
+	uint16_t string[ 80 ];
+
+	const uint16_t *match = NULL;
+	size_t match_index    = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		string[ string_index ] = (uint16_t) ( 'a' + ( string_index % 26 ) );
+	}
+	/* Test every combination of string length and match position to cover the vector
+	 * loops and the scalar tail, including code unit values with the most significant bit set
+	 */
+	for( string_length = 0;
+	     string_length <= 80;
+	     string_length++ )
+	{
+		match = libcsplit_simd_search_uint16(
+		         string,
+		         (uint16_t) ',',
+		         string_length );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "match",
+		 match );
+
+		for( match_index = 0;
+		     match_index < string_length;
+		     match_index++ )
+		{
+			string[ match_index ] = (uint16_t) 0x8000;
+
+			match = libcsplit_simd_search_uint16(
+			         string,
+			         (uint16_t) 0x8000,
+			         string_length );
+
+			string[ match_index ] = (uint16_t) ( 'a' + ( match_index % 26 ) );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "match",
+			 match );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "match index",
+			 (size_t) ( match - string ),
+			 match_index );
+		}
+	}
+	/* Test the first match is returned
+	 */
+	string[ 40 ] = (uint16_t) ',';
+	string[ 70 ] = (uint16_t) ',';
+
+	match = libcsplit_simd_search_uint16(
+	         &( string[ 1 ] ),
+	         (uint16_t) ',',
+	         79 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "match",
+	 match );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "match index",
+	 (size_t) ( match - string ),
+	 (size_t) 40 );
+
+	/* Test error cases
+	 */
+	match = libcsplit_simd_search_uint16(
+	         NULL,
+	         (uint16_t) ',',
+	         80 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_uint32 function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_uint32(
+     void )
+{
+	uint32_t string[ 80 ];
+
+	const uint32_t *match = NULL;
+	size_t match_index    = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		string[ string_index ] = (uint32_t) ( 'a' + ( string_index % 26 ) );
+	}
+	/* Test every combination of string length and match position to cover the vector
+	 * loops and the scalar tail, including code unit values with the most significant bit set
+	 */
+	for( string_length = 0;
+	     string_length <= 80;
+	     string_length++ )
+	{
+		match = libcsplit_simd_search_uint32(
+		         string,
+		         (uint32_t) ',',
+		         string_length );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "match",
+		 match );
+
+		for( match_index = 0;
+		     match_index < string_length;
+		     match_index++ )
+		{
+			string[ match_index ] = (uint32_t) 0x80000000UL;
+
+			match = libcsplit_simd_search_uint32(
+			         string,
+			         (uint32_t) 0x80000000UL,
+			         string_length );
+
+			string[ match_index ] = (uint32_t) ( 'a' + ( match_index % 26 ) );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "match",
+			 match );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "match index",
+			 (size_t) ( match - string ),
+			 match_index );
+		}
+	}
+	/* Test the first match is returned
+	 */
+	string[ 40 ] = (uint32_t) ',';
+	string[ 70 ] = (uint32_t) ',';
+
+	match = libcsplit_simd_search_uint32(
+	         &( string[ 1 ] ),
+	         (uint32_t) ',',
+	         79 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "match",
+	 match );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "match index",
+	 (size_t) ( match - string ),
+	 (size_t) 40 );
+
+	/* Test error cases
+	 */
+	match = libcsplit_simd_search_uint32(
+	         NULL,
+	         (uint32_t) ',',
+	         80 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcsplit_simd_search_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_wide(
+     void )
+{
+	wchar_t string[ 80 ];
+
+	const wchar_t *match = NULL;
+	size_t match_index   = 0;
+	size_t string_index  = 0;
+	size_t string_length = 0;
+
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		string[ string_index ] = (wchar_t) ( 'a' + ( string_index % 26 ) );
+	}
+	/* Test every combination of string length and match position to cover the vector
+	 * loops and the scalar tail of the size of wchar_t
+	 */
+	for( string_length = 0;
+	     string_length <= 80;
+	     string_length++ )
+	{
+		match = libcsplit_simd_search_wide(
+		         string,
+		         (wchar_t) ',',
+		         string_length );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "match",
+		 match );
+
+		for( match_index = 0;
+		     match_index < string_length;
+		     match_index++ )
+		{
+			string[ match_index ] = (wchar_t) 0x7fff;
+
+			match = libcsplit_simd_search_wide(
+			         string,
+			         (wchar_t) 0x7fff,
+			         string_length );
+
+			string[ match_index ] = (wchar_t) ( 'a' + ( match_index % 26 ) );
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "match",
+			 match );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "match index",
+			 (size_t) ( match - string ),
+			 match_index );
+		}
+	}
+	/* Test the first match is returned
+	 */
+	string[ 40 ] = (wchar_t) ',';
+	string[ 70 ] = (wchar_t) ',';
+
+	match = libcsplit_simd_search_wide(
+	         &( string[ 1 ] ),
+	         (wchar_t) ',',
+	         79 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "match",
+	 match );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "match index",
+	 (size_t) ( match - string ),
+	 (size_t) 40 );
+
+	/* Test error cases
+	 */
+	match = libcsplit_simd_search_wide(
+	         NULL,
+	         (wchar_t) ',',
+	         80 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libcsplit_simd_search_uint16_little_endian function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_uint16_little_endian(
+     void )
+{
+	uint8_t byte_stream[ 160 ];
+
+	const uint8_t *match    = NULL;
+	size_t byte_stream_size = 0;
+	size_t match_index      = 0;
+	size_t stream_index     = 0;
+
+	for( stream_index = 0;
+	     stream_index < 160;
+	     stream_index += 2 )
+	{
+		byte_stream[ stream_index ]     = (uint8_t) ( 'a' + ( ( stream_index / 2 ) % 26 ) );
+		byte_stream[ stream_index + 1 ] = 0;
+	}
+	/* Test every combination of stream size and match position to cover the vector
+	 * loops and the scalar tail, including code unit values with the most significant bit set
+	 */
+	for( byte_stream_size = 0;
+	     byte_stream_size <= 160;
+	     byte_stream_size++ )
+	{
+		match = libcsplit_simd_search_uint16_little_endian(
+		         byte_stream,
+		         (uint16_t) ',',
+		         byte_stream_size );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "match",
+		 match );
+
+		for( match_index = 0;
+		     ( match_index + 1 ) < byte_stream_size;
+		     match_index += 2 )
+		{
+			byte_stream[ match_index ]     = 0x34;
+			byte_stream[ match_index + 1 ] = 0x82;
+
+			match = libcsplit_simd_search_uint16_little_endian(
+			         byte_stream,
+			         (uint16_t) 0x8234,
+			         byte_stream_size );
+
+			byte_stream[ match_index ]     = (uint8_t) ( 'a' + ( ( match_index / 2 ) % 26 ) );
+			byte_stream[ match_index + 1 ] = 0;
+
+			CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+			 "match",
+			 match );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "match index",
+			 (size_t) ( match - byte_stream ),
+			 match_index );
+		}
+	}
+	/* Test a code unit that straddles two code units is not matched
+	 */
+	byte_stream[ 41 ] = 0x34;
+	byte_stream[ 42 ] = 0x82;
+
+	match = libcsplit_simd_search_uint16_little_endian(
+	         byte_stream,
+	         (uint16_t) 0x8234,
+	         160 );
+
+	byte_stream[ 41 ] = 0;
+	byte_stream[ 42 ] = (uint8_t) ( 'a' + 21 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	/* Test the first match is returned
+	 */
+	byte_stream[ 80 ]  = (uint8_t) ',';
+	byte_stream[ 140 ] = (uint8_t) ',';
+
+	match = libcsplit_simd_search_uint16_little_endian(
+	         &( byte_stream[ 2 ] ),
+	         (uint16_t) ',',
+	         158 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "match",
+	 match );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "match index",
+	 (size_t) ( match - byte_stream ),
+	 (size_t) 80 );
+
+	/* Test error cases
+	 */
+	match = libcsplit_simd_search_uint16_little_endian(
+	         NULL,
+	         (uint16_t) ',',
+	         160 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_uint16_pair function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_uint16_pair(
+     void )
+{
+	uint16_t string[ 80 ];
+
+	const uint16_t *match = NULL;
+	size_t match_index    = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+
+	for( string_index = 0;
+	     string_index < 80;
+	     string_index++ )
+	{
+		string[ string_index ] = (uint16_t) ( 'a' + ( string_index % 26 ) );
+	}
+	/* Test every combination of string length and match position to cover the vector
+	 * loops, pairs that cross a vector boundary and the scalar tail
+	 */
+	for( string_length = 0;
+	     string_length <= 80;
+	     string_length++ )
+	{
+		for( match_index = 0;
+		     match_index < string_length;
+		     match_index++ )
+		{
+			/* Test an unpaired first code unit is not matched
+			 */
+			string[ match_index ] = (uint16_t) 0xd83d;
+
+			match = libcsplit_simd_search_uint16_pair(
+			         string,
+			         (uint16_t) 0xd83d,
+			         (uint16_t) 0xde00,
+			         string_length );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "match",
+			 match );
+
+			if( ( match_index + 1 ) < string_length )
+			{
+				string[ match_index + 1 ] = (uint16_t) 0xde00;
+
+				match = libcsplit_simd_search_uint16_pair(
+				         string,
+				         (uint16_t) 0xd83d,
+				         (uint16_t) 0xde00,
+				         string_length );
+
+				string[ match_index + 1 ] = (uint16_t) ( 'a' + ( ( match_index + 1 ) % 26 ) );
+
+				CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+				 "match",
+				 match );
+
+				CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+				 "match index",
+				 (size_t) ( match - string ),
+				 match_index );
+			}
+			string[ match_index ] = (uint16_t) ( 'a' + ( match_index % 26 ) );
+		}
+	}
+	/* Test error cases
+	 */
+	match = libcsplit_simd_search_uint16_pair(
+	         NULL,
+	         (uint16_t) 0xd83d,
+	         (uint16_t) 0xde00,
+	         80 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "match",
+	 match );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_span_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_span_ascii(
+     void )
+{
+	uint8_t stop_bytes[ 3 ] = { 0x00, (uint8_t) ',', 0xc3 };
+	uint8_t byte_stream[ 80 ];
+
+	size_t byte_stream_size = 0;
+	size_t span             = 0;
+	size_t stop_index       = 0;
+	size_t stream_index     = 0;
+	int stop_byte_index     = 0;
+
+	for( stream_index = 0;
+	     stream_index < 80;
+	     stream_index++ )
+	{
+		byte_stream[ stream_index ] = (uint8_t) ( 'a' + ( stream_index % 26 ) );
+	}
+	/* Test every combination of stream size and stop position to cover the vector
+	 * loops and the scalar tail, for the end-of-string character, the stop byte
+	 * and a byte with the most significant bit set
+	 */
+	for( byte_stream_size = 0;
+	     byte_stream_size <= 80;
+	     byte_stream_size++ )
+	{
+		span = libcsplit_simd_span_ascii(
+		        byte_stream,
+		        (uint8_t) ',',
+		        byte_stream_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "span",
+		 span,
+		 byte_stream_size );
+
+		for( stop_index = 0;
+		     stop_index < byte_stream_size;
+		     stop_index++ )
+		{
+			for( stop_byte_index = 0;
+			     stop_byte_index < 3;
+			     stop_byte_index++ )
+			{
+				byte_stream[ stop_index ] = stop_bytes[ stop_byte_index ];
+
+				span = libcsplit_simd_span_ascii(
+				        byte_stream,
+				        (uint8_t) ',',
+				        byte_stream_size );
+
+				byte_stream[ stop_index ] = (uint8_t) ( 'a' + ( stop_index % 26 ) );
+
+				CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+				 "span",
+				 span,
+				 stop_index );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	span = libcsplit_simd_span_ascii(
+	        NULL,
+	        (uint8_t) ',',
+	        80 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "span",
+	 span,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_unquoted function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_unquoted(
+     void )
+{
+	uint8_t byte_stream[ 256 ];
+
+	size_t byte_stream_offset = 0;
+	size_t byte_stream_size   = 0;
+	size_t expected_offset    = 0;
+	size_t offset             = 0;
+	size_t stream_index       = 0;
+	uint32_t value            = 1;
+	uint8_t quote_state       = 0;
+	uint8_t expected_state    = 0;
+	uint8_t initial_state     = 0;
+
+	/* Use a pseudo random mix of delimiters, quotes and other bytes
+	 * with few delimiters so that quoted sections span the vector blocks
+	 */
+	for( stream_index = 0;
+	     stream_index < 256;
+	     stream_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		if( ( ( value >> 16 ) % 64 ) == 0 )
+		{
+			byte_stream[ stream_index ] = (uint8_t) ',';
+		}
+		else if( ( ( value >> 16 ) % 64 ) < 3 )
+		{
+			byte_stream[ stream_index ] = (uint8_t) '"';
+		}
+		else
+		{
+			byte_stream[ stream_index ] = (uint8_t) 'a';
+		}
+	}
+	/* Compare every stream offset, stream size and initial quote state with a search one byte at a time
+	 */
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < 256;
+	     byte_stream_offset++ )
+	{
+		for( byte_stream_size = 0;
+		     ( byte_stream_offset + byte_stream_size ) <= 256;
+		     byte_stream_size++ )
+		{
+			for( initial_state = 0;
+			     initial_state < 2;
+			     initial_state++ )
+			{
+				expected_state = initial_state;
+
+				for( expected_offset = 0;
+				     expected_offset < byte_stream_size;
+				     expected_offset++ )
+				{
+					if( byte_stream[ byte_stream_offset + expected_offset ] == (uint8_t) '"' )
+					{
+						expected_state ^= 1;
+					}
+					else if( ( expected_state == 0 )
+					      && ( byte_stream[ byte_stream_offset + expected_offset ] == (uint8_t) ',' ) )
+					{
+						break;
+					}
+				}
+				quote_state = initial_state;
+
+				offset = libcsplit_simd_search_unquoted(
+				          &( byte_stream[ byte_stream_offset ] ),
+				          (uint8_t) ',',
+				          (uint8_t) '"',
+				          byte_stream_size,
+				          &quote_state );
+
+				CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+				 "offset",
+				 offset,
+				 expected_offset );
+
+				CSPLIT_TEST_ASSERT_EQUAL_INT(
+				 "quote_state",
+				 (int) quote_state,
+				 (int) expected_state );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	offset = libcsplit_simd_search_unquoted(
+	          NULL,
+	          (uint8_t) ',',
+	          (uint8_t) '"',
+	          256,
+	          &quote_state );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_unescaped function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_unescaped(
+     void )
+{
+	uint8_t byte_stream[ 256 ];
+
+	size_t byte_stream_offset = 0;
+	size_t byte_stream_size   = 0;
+	size_t expected_offset    = 0;
+	size_t offset             = 0;
+	size_t stream_index       = 0;
+	uint32_t value            = 1;
+	uint8_t escape_state      = 0;
+	uint8_t expected_state    = 0;
+	uint8_t initial_state     = 0;
+
+	/* Use a pseudo random mix of delimiters, escapes and other bytes
+	 * with few delimiters and runs of escapes of different lengths
+	 */
+	for( stream_index = 0;
+	     stream_index < 256;
+	     stream_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		if( ( ( value >> 16 ) % 64 ) == 0 )
+		{
+			byte_stream[ stream_index ] = (uint8_t) ',';
+		}
+		else if( ( ( value >> 16 ) % 64 ) < 25 )
+		{
+			byte_stream[ stream_index ] = (uint8_t) '\\';
+		}
+		else
+		{
+			byte_stream[ stream_index ] = (uint8_t) 'a';
+		}
+	}
+	/* Compare every stream offset, stream size and initial escape state with a search one byte at a time
+	 */
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < 256;
+	     byte_stream_offset++ )
+	{
+		for( byte_stream_size = 0;
+		     ( byte_stream_offset + byte_stream_size ) <= 256;
+		     byte_stream_size++ )
+		{
+			for( initial_state = 0;
+			     initial_state < 2;
+			     initial_state++ )
+			{
+				expected_state = initial_state;
+
+				for( expected_offset = 0;
+				     expected_offset < byte_stream_size;
+				     expected_offset++ )
+				{
+					if( expected_state != 0 )
+					{
+						expected_state = 0;
+					}
+					else if( byte_stream[ byte_stream_offset + expected_offset ] == (uint8_t) '\\' )
+					{
+						expected_state = 1;
+					}
+					else if( byte_stream[ byte_stream_offset + expected_offset ] == (uint8_t) ',' )
+					{
+						break;
+					}
+				}
+				escape_state = initial_state;
+
+				offset = libcsplit_simd_search_unescaped(
+				          &( byte_stream[ byte_stream_offset ] ),
+				          (uint8_t) ',',
+				          (uint8_t) '\\',
+				          byte_stream_size,
+				          &escape_state );
+
+				CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+				 "offset",
+				 offset,
+				 expected_offset );
+
+				CSPLIT_TEST_ASSERT_EQUAL_INT(
+				 "escape_state",
+				 (int) escape_state,
+				 (int) expected_state );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	offset = libcsplit_simd_search_unescaped(
+	          NULL,
+	          (uint8_t) ',',
+	          (uint8_t) '\\',
+	          256,
+	          &escape_state );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_whitespace_transition function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_whitespace_transition(
+     void )
+{
+	uint8_t byte_values[ 10 ] = { ' ', '\t', '\n', '\v', '\f', '\r', 0x08, 0x0e, 0xa0, 'a' };
+	uint8_t byte_stream[ 256 ];
+
+	size_t byte_stream_offset = 0;
+	size_t byte_stream_size   = 0;
+	size_t expected_offset    = 0;
+	size_t offset             = 0;
+	size_t stream_index       = 0;
+	uint32_t value            = 1;
+	uint8_t expected_state    = 0;
+	uint8_t initial_state     = 0;
+	uint8_t is_whitespace     = 0;
+	uint8_t whitespace_state  = 0;
+
+	/* Use a pseudo random mix of runs of whitespace and other bytes, including
+	 * the bytes adjacent to the range of horizontal tab to carriage return
+	 */
+	for( stream_index = 0;
+	     stream_index < 256;
+	     stream_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		if( ( ( ( value >> 16 ) % 8 ) != 0 )
+		 && ( stream_index > 0 ) )
+		{
+			byte_stream[ stream_index ] = byte_stream[ stream_index - 1 ];
+		}
+		else
+		{
+			byte_stream[ stream_index ] = byte_values[ ( value >> 20 ) % 10 ];
+		}
+	}
+	/* Compare every stream offset, stream size and initial whitespace state with a search one byte at a time
+	 */
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < 256;
+	     byte_stream_offset++ )
+	{
+		for( byte_stream_size = 0;
+		     ( byte_stream_offset + byte_stream_size ) <= 256;
+		     byte_stream_size++ )
+		{
+			for( initial_state = 0;
+			     initial_state < 2;
+			     initial_state++ )
+			{
+				expected_state = initial_state;
+
+				for( expected_offset = 0;
+				     expected_offset < byte_stream_size;
+				     expected_offset++ )
+				{
+					for( stream_index = 0;
+					     stream_index < 6;
+					     stream_index++ )
+					{
+						if( byte_stream[ byte_stream_offset + expected_offset ] == byte_values[ stream_index ] )
+						{
+							break;
+						}
+					}
+					is_whitespace = (uint8_t) ( stream_index < 6 );
+
+					if( is_whitespace != expected_state )
+					{
+						expected_state = is_whitespace;
+
+						break;
+					}
+				}
+				whitespace_state = initial_state;
+
+				offset = libcsplit_simd_search_whitespace_transition(
+				          &( byte_stream[ byte_stream_offset ] ),
+				          byte_stream_size,
+				          &whitespace_state );
+
+				CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+				 "offset",
+				 offset,
+				 expected_offset );
+
+				CSPLIT_TEST_ASSERT_EQUAL_INT(
+				 "whitespace_state",
+				 (int) whitespace_state,
+				 (int) expected_state );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	offset = libcsplit_simd_search_whitespace_transition(
+	          NULL,
+	          256,
+	          &whitespace_state );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_simd_search_byte_class function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_simd_search_byte_class(
+     void )
+{
+	uint8_t byte_values[ 10 ] = { '\n', '\t', ',', 0x8a, 'a', 0x1a, '*', 0x8c, 0xfa, 0x00 };
+	uint8_t high_nibble_classes[ 16 ];
+	uint8_t low_nibble_classes[ 16 ];
+	uint8_t byte_stream[ 256 ];
+
+	size_t byte_stream_offset = 0;
+	size_t byte_stream_size   = 0;
+	size_t expected_offset    = 0;
+	size_t offset             = 0;
+	size_t stream_index       = 0;
+	uint32_t value            = 1;
+	uint8_t byte_class        = 0;
+	int value_index           = 0;
+
+	/* Assign a class bit to the first 4 byte values, the other byte values
+	 * share a nibble with one of them
+	 */
+	for( stream_index = 0;
+	     stream_index < 16;
+	     stream_index++ )
+	{
+		high_nibble_classes[ stream_index ] = 0;
+		low_nibble_classes[ stream_index ]  = 0;
+	}
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		low_nibble_classes[ byte_values[ value_index ] & 0x0f ] |= (uint8_t) ( 1 << value_index );
+		high_nibble_classes[ byte_values[ value_index ] >> 4 ]  |= (uint8_t) ( 1 << value_index );
+	}
+	/* Use a pseudo random mix of bytes with and without a class
+	 */
+	for( stream_index = 0;
+	     stream_index < 256;
+	     stream_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		if( ( ( value >> 16 ) % 16 ) != 0 )
+		{
+			byte_stream[ stream_index ] = byte_values[ 4 + ( ( value >> 20 ) % 6 ) ];
+		}
+		else
+		{
+			byte_stream[ stream_index ] = byte_values[ ( value >> 20 ) % 4 ];
+		}
+	}
+	/* Compare every stream offset and stream size with a search one byte at a time
+	 */
+	for( byte_stream_offset = 0;
+	     byte_stream_offset < 256;
+	     byte_stream_offset++ )
+	{
+		for( byte_stream_size = 0;
+		     ( byte_stream_offset + byte_stream_size ) <= 256;
+		     byte_stream_size++ )
+		{
+			for( expected_offset = 0;
+			     expected_offset < byte_stream_size;
+			     expected_offset++ )
+			{
+				for( value_index = 0;
+				     value_index < 4;
+				     value_index++ )
+				{
+					if( byte_stream[ byte_stream_offset + expected_offset ] == byte_values[ value_index ] )
+					{
+						break;
+					}
+				}
+				if( value_index < 4 )
+				{
+					break;
+				}
+			}
+			offset = libcsplit_simd_search_byte_class(
+			          &( byte_stream[ byte_stream_offset ] ),
+			          low_nibble_classes,
+			          high_nibble_classes,
+			          byte_stream_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "offset",
+			 offset,
+			 expected_offset );
+
+			if( offset < byte_stream_size )
+			{
+				byte_class = LIBCSPLIT_SIMD_GET_BYTE_CLASS(
+				              low_nibble_classes,
+				              high_nibble_classes,
+				              byte_stream[ byte_stream_offset + offset ] );
+
+				CSPLIT_TEST_ASSERT_EQUAL_INT(
+				 "byte_class",
+				 (int) byte_class,
+				 1 << value_index );
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	offset = libcsplit_simd_search_byte_class(
+	          NULL,
+	          low_nibble_classes,
+	          high_nibble_classes,
+	          256 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 0 );
+
+	offset = libcsplit_simd_search_byte_class(
+	          byte_stream,
+	          NULL,
+	          high_nibble_classes,
+	          256 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "offset",
+	 offset,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_uint16",
+	 csplit_test_simd_search_uint16 );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_uint32",
+	 csplit_test_simd_search_uint32 );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_wide",
+	 csplit_test_simd_search_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_uint16_little_endian",
+	 csplit_test_simd_search_uint16_little_endian );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_uint16_pair",
+	 csplit_test_simd_search_uint16_pair );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_span_ascii",
+	 csplit_test_simd_span_ascii );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_unquoted",
+	 csplit_test_simd_search_unquoted );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_unescaped",
+	 csplit_test_simd_search_unescaped );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_whitespace_transition",
+	 csplit_test_simd_search_whitespace_transition );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_simd_search_byte_class",
+	 csplit_test_simd_search_byte_class );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+}
+
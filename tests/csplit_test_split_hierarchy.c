@@ -0,0 +1,784 @@
+/*
+ * Library split_hierarchy type test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+/* Creates a split hierarchy of a pseudo random string of 512 characters
+ * with record, field and subfield delimiters
+ * Returns 1 if successful or -1 on error
+ */
+int csplit_test_split_hierarchy_create(
+     libcsplit_split_hierarchy_t **split_hierarchy,
+     libcerror_error_t **error )
+{
+	char characters[ 8 ] = { 'a', 'b', 'c', 'd', 'e', '\n', '\t', ',' };
+	char string[ 513 ];
+
+	size_t string_index = 0;
+	uint32_t value      = 1;
+
+	for( string_index = 0;
+	     string_index < 512;
+	     string_index++ )
+	{
+		value = ( value * 1103515245UL ) + 12345;
+
+		string[ string_index ] = characters[ ( value >> 16 ) % 8 ];
+	}
+	string[ 512 ] = 0;
+
+	return( libcsplit_narrow_string_split_hierarchy(
+	         string,
+	         513,
+	         "\n\t,",
+	         3,
+	         split_hierarchy,
+	         error ) );
+}
+
+/* Tests the libcsplit_split_hierarchy_free function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_split_hierarchy_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcsplit_split_hierarchy_free(
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_split_hierarchy_get_number_of_levels function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_split_hierarchy_get_number_of_levels(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcsplit_split_hierarchy_t *split_hierarchy = NULL;
+	int number_of_levels                         = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_split_hierarchy_create(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_hierarchy",
+	 split_hierarchy );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_split_hierarchy_get_number_of_levels(
+	          split_hierarchy,
+	          &number_of_levels,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_levels",
+	 number_of_levels,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_split_hierarchy_get_number_of_levels(
+	          NULL,
+	          &number_of_levels,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_number_of_levels(
+	          split_hierarchy,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_split_hierarchy_free(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_hierarchy != NULL )
+	{
+		libcsplit_split_hierarchy_free(
+		 &split_hierarchy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_split_hierarchy_get_segment_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_split_hierarchy_get_segment_by_index(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcsplit_split_hierarchy_t *split_hierarchy = NULL;
+	size_t segment_offset                        = 0;
+	size_t segment_size                          = 0;
+	int number_of_segments                       = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_split_hierarchy_create(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_hierarchy",
+	 split_hierarchy );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the last segment of every level ends at the end of the string
+	 */
+	result = libcsplit_split_hierarchy_get_number_of_segments(
+	          split_hierarchy,
+	          2,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          split_hierarchy,
+	          2,
+	          number_of_segments - 1,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_end_offset",
+	 segment_offset + segment_size,
+	 (size_t) 512 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          NULL,
+	          0,
+	          0,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          split_hierarchy,
+	          3,
+	          0,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          split_hierarchy,
+	          2,
+	          number_of_segments,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          split_hierarchy,
+	          0,
+	          0,
+	          NULL,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_segment_by_index(
+	          split_hierarchy,
+	          0,
+	          0,
+	          &segment_offset,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_split_hierarchy_free(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_hierarchy != NULL )
+	{
+		libcsplit_split_hierarchy_free(
+		 &split_hierarchy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_split_hierarchy_get_child_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_split_hierarchy_get_child_segments(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcsplit_split_hierarchy_t *split_hierarchy = NULL;
+	size_t child_segment_offset                  = 0;
+	size_t child_segment_size                    = 0;
+	size_t segment_offset                        = 0;
+	size_t segment_size                          = 0;
+	int expected_first_child_segment_index       = 0;
+	int first_child_segment_index                = 0;
+	int level                                    = 0;
+	int number_of_child_segments                 = 0;
+	int number_of_next_level_segments            = 0;
+	int number_of_segments                       = 0;
+	int result                                   = 0;
+	int segment_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = csplit_test_split_hierarchy_create(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_hierarchy",
+	 split_hierarchy );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the child segments of every segment are consecutive, start at the start
+	 * of the segment and end at the end of the segment
+	 */
+	for( level = 0;
+	     level < 2;
+	     level++ )
+	{
+		result = libcsplit_split_hierarchy_get_number_of_segments(
+		          split_hierarchy,
+		          level,
+		          &number_of_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_split_hierarchy_get_number_of_segments(
+		          split_hierarchy,
+		          level + 1,
+		          &number_of_next_level_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_first_child_segment_index = 0;
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			result = libcsplit_split_hierarchy_get_segment_by_index(
+			          split_hierarchy,
+			          level,
+			          segment_index,
+			          &segment_offset,
+			          &segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcsplit_split_hierarchy_get_child_segments(
+			          split_hierarchy,
+			          level,
+			          segment_index,
+			          &first_child_segment_index,
+			          &number_of_child_segments,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "first_child_segment_index",
+			 first_child_segment_index,
+			 expected_first_child_segment_index );
+
+			CSPLIT_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_child_segments",
+			 number_of_child_segments,
+			 0 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcsplit_split_hierarchy_get_segment_by_index(
+			          split_hierarchy,
+			          level + 1,
+			          first_child_segment_index,
+			          &child_segment_offset,
+			          &child_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "child_segment_offset",
+			 child_segment_offset,
+			 segment_offset );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcsplit_split_hierarchy_get_segment_by_index(
+			          split_hierarchy,
+			          level + 1,
+			          first_child_segment_index + number_of_child_segments - 1,
+			          &child_segment_offset,
+			          &child_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "child_segment_end_offset",
+			 child_segment_offset + child_segment_size,
+			 segment_offset + segment_size );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			expected_first_child_segment_index += number_of_child_segments;
+		}
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "expected_first_child_segment_index",
+		 expected_first_child_segment_index,
+		 number_of_next_level_segments );
+	}
+	/* Test error cases
+	 */
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          NULL,
+	          0,
+	          0,
+	          &first_child_segment_index,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The last level has no child segments
+	 */
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          2,
+	          0,
+	          &first_child_segment_index,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          0,
+	          -1,
+	          &first_child_segment_index,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          0,
+	          0,
+	          NULL,
+	          &number_of_child_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_split_hierarchy_get_child_segments(
+	          split_hierarchy,
+	          0,
+	          0,
+	          &first_child_segment_index,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_split_hierarchy_free(
+	          &split_hierarchy,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_hierarchy != NULL )
+	{
+		libcsplit_split_hierarchy_free(
+		 &split_hierarchy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_split_hierarchy_free",
+	 csplit_test_split_hierarchy_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_split_hierarchy_get_number_of_levels",
+	 csplit_test_split_hierarchy_get_number_of_levels );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_split_hierarchy_get_segment_by_index",
+	 csplit_test_split_hierarchy_get_segment_by_index );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_split_hierarchy_get_child_segments",
+	 csplit_test_split_hierarchy_get_child_segments );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,549 @@
+/*
+ * Library UTF-16 stream functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+/* Copies a narrow string into a UTF-16 stream
+ */
+void csplit_test_utf16_stream_copy_from_narrow(
+      uint8_t *utf16_stream,
+      const char *string,
+      size_t string_size,
+      int byte_order )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		if( byte_order == LIBCSPLIT_ENDIAN_BIG )
+		{
+			utf16_stream[ 2 * string_index ]         = 0;
+			utf16_stream[ ( 2 * string_index ) + 1 ] = (uint8_t) string[ string_index ];
+		}
+		else
+		{
+			utf16_stream[ 2 * string_index ]         = (uint8_t) string[ string_index ];
+			utf16_stream[ ( 2 * string_index ) + 1 ] = 0;
+		}
+	}
+}
+
+/* Tests the libcsplit_utf16_stream_split function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf16_stream_split(
+     void )
+{
+	uint8_t utf16_stream[ 32 ];
+
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_table_t *segment_table = NULL;
+	size_t segment_offset                    = 0;
+	size_t segment_size                      = 0;
+	int number_of_segments                   = 0;
+	int result                               = 0;
+
+	csplit_test_utf16_stream_copy_from_narrow(
+	 utf16_stream,
+	 "ab,c,,de",
+	 9,
+	 LIBCSPLIT_ENDIAN_LITTLE );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          18,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_segment_by_index(
+	          segment_table,
+	          1,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_offset",
+	 segment_offset,
+	 (size_t) 6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_size",
+	 segment_size,
+	 (size_t) 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_segment_by_index(
+	          segment_table,
+	          2,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_offset",
+	 segment_offset,
+	 (size_t) 10 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_size",
+	 segment_size,
+	 (size_t) 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_segment_by_index(
+	          segment_table,
+	          3,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_offset",
+	 segment_offset,
+	 (size_t) 12 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_size",
+	 segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_segment_by_index(
+	          segment_table,
+	          4,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a big-endian stream without end-of-string code unit
+	 */
+	csplit_test_utf16_stream_copy_from_narrow(
+	 utf16_stream,
+	 "ab,c,,de",
+	 8,
+	 LIBCSPLIT_ENDIAN_BIG );
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          16,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_BIG,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_segment_by_index(
+	          segment_table,
+	          3,
+	          &segment_offset,
+	          &segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_offset",
+	 segment_offset,
+	 (size_t) 12 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_size",
+	 segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a code unit containing the delimiter byte is not a delimiter
+	 * U+2C00 is stored as 0x00 0x2c in a little-endian stream
+	 */
+	csplit_test_utf16_stream_copy_from_narrow(
+	 utf16_stream,
+	 "a,b",
+	 3,
+	 LIBCSPLIT_ENDIAN_LITTLE );
+
+	utf16_stream[ 4 ] = 0x00;
+	utf16_stream[ 5 ] = 0x2c;
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          6,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty stream
+	 */
+	utf16_stream[ 0 ] = 0;
+	utf16_stream[ 1 ] = 0;
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          2,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf16_stream_split(
+	          NULL,
+	          18,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          17,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          18,
+	          (uint16_t) ',',
+	          -1,
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf16_stream_split(
+	          utf16_stream,
+	          18,
+	          (uint16_t) ',',
+	          LIBCSPLIT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libcsplit_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf16_stream_split",
+	 csplit_test_utf16_stream_split );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
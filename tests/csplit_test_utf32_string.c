@@ -0,0 +1,626 @@
+/*
+ * Library UTF-32 string functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+/* Copies a narrow string into a UTF-32 string
+ */
+void csplit_test_utf32_string_copy_from_narrow(
+      uint32_t *utf32_string,
+      const char *string,
+      size_t string_size )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		utf32_string[ string_index ] = (uint32_t) (uint8_t) string[ string_index ];
+	}
+}
+
+/* Tests the libcsplit_utf32_string_split function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf32_string_split(
+     void )
+{
+	uint32_t expected_string[ 16 ];
+	uint32_t joined_string[ 16 ];
+	uint32_t string[ 16 ];
+
+	libcerror_error_t *error                     = NULL;
+	libcsplit_utf32_split_string_t *split_string = NULL;
+	uint32_t *string_segment                     = NULL;
+	size_t joined_string_size                    = 0;
+	size_t string_segment_size                   = 0;
+	int number_of_segments                       = 0;
+	int result                                   = 0;
+
+	csplit_test_utf32_string_copy_from_narrow(
+	 string,
+	 "1 2 3 4  5",
+	 11 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_utf32_string_split(
+	          string,
+	          11,
+	          (uint32_t) ' ',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 6 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_segment_by_index(
+	          split_string,
+	          4,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_segment_by_index(
+	          split_string,
+	          5,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "string_segment[ 0 ]",
+	 (int) string_segment[ 0 ],
+	 (int) '5' );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test joining the segments
+	 */
+	result = libcsplit_utf32_split_string_get_joined_string_size(
+	          split_string,
+	          &joined_string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "joined_string_size",
+	 joined_string_size,
+	 (size_t) 11 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_join(
+	          split_string,
+	          (uint32_t) ',',
+	          joined_string,
+	          16,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	csplit_test_utf32_string_copy_from_narrow(
+	 expected_string,
+	 "1,2,3,4,,5",
+	 11 );
+
+	result = memory_compare(
+	          joined_string,
+	          expected_string,
+	          sizeof( uint32_t ) * 11 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_utf32_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a delimiter outside the 8-bit range
+	 */
+	string[ 1 ] = 0x3000;
+	string[ 3 ] = 0x3000;
+
+	result = libcsplit_utf32_string_split(
+	          string,
+	          11,
+	          0x3000,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf32_string_split(
+	          NULL,
+	          11,
+	          (uint32_t) ' ',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf32_string_split(
+	          string,
+	          11,
+	          (uint32_t) ' ',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_utf32_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_utf32_string_split_path function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf32_string_split_path(
+     void )
+{
+	uint32_t path[ 32 ];
+
+	libcerror_error_t *error                     = NULL;
+	libcsplit_utf32_split_string_t *split_string = NULL;
+	uint32_t *string_segment                     = NULL;
+	size_t string_segment_size                   = 0;
+	int number_of_segments                       = 0;
+	int result                                   = 0;
+
+	csplit_test_utf32_string_copy_from_narrow(
+	 path,
+	 "/usr//local/./lib/../bin/",
+	 26 );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_utf32_string_split_path(
+	          path,
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_get_segment_by_index(
+	          split_string,
+	          3,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "string_segment[ 0 ]",
+	 (int) string_segment[ 0 ],
+	 (int) 'b' );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_utf32_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf32_string_split_path(
+	          NULL,
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_utf32_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_utf32_string_transcode_delimiters function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf32_string_transcode_delimiters(
+     void )
+{
+	uint32_t delimiters[ 2 ];
+	uint32_t expected_string[ 16 ];
+	uint32_t string[ 16 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t transcoded_string_length = 0;
+	int result                      = 0;
+
+	csplit_test_utf32_string_copy_from_narrow(
+	 string,
+	 ",,a,;b,c,,",
+	 11 );
+
+	/* Use a delimiter outside the 8-bit range instead of ';'
+	 */
+	string[ 4 ] = 0x3000;
+
+	delimiters[ 0 ] = (uint32_t) ',';
+	delimiters[ 1 ] = 0x3000;
+
+	/* Test transcoding in place
+	 */
+	result = libcsplit_utf32_string_transcode_delimiters(
+	          string,
+	          11,
+	          delimiters,
+	          2,
+	          (uint32_t) '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS | LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          string,
+	          11,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 5 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	csplit_test_utf32_string_copy_from_narrow(
+	 expected_string,
+	 "a\tb\tc",
+	 6 );
+
+	result = memory_compare(
+	          string,
+	          expected_string,
+	          sizeof( uint32_t ) * 6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf32_string_transcode_delimiters(
+	          string,
+	          11,
+	          NULL,
+	          2,
+	          (uint32_t) '\t',
+	          0,
+	          string,
+	          11,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf32_string_split",
+	 csplit_test_utf32_string_split );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf32_string_split_path",
+	 csplit_test_utf32_string_split_path );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf32_string_transcode_delimiters",
+	 csplit_test_utf32_string_transcode_delimiters );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,747 @@
+/*
+ * Library UTF-8 string functions test program
+ *
+ * Copyright (C) 2008-2023, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "csplit_test_libcerror.h"
+#include "csplit_test_libcsplit.h"
+#include "csplit_test_macros.h"
+#include "csplit_test_memory.h"
+#include "csplit_test_unused.h"
+
+#include "../libcsplit/libcsplit_utf8_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+/* Tests the libcsplit_utf8_string_get_sequence_size function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf8_string_get_sequence_size(
+     void )
+{
+	int sequence_size = 0;
+
+	/* Test regular cases
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xc2\xa6",
+	                 2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 2 );
+
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xe2\x80\xa8",
+	                 3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 3 );
+
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xf4\x8f\xbf\xbf",
+	                 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 4 );
+
+	/* Test an overlong sequence
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xe0\x80\xaf",
+	                 3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 0 );
+
+	/* Test a surrogate
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xed\xa0\x80",
+	                 3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 0 );
+
+	/* Test a code point beyond U+10FFFF
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xf4\x90\x80\x80",
+	                 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 0 );
+
+	/* Test an incomplete sequence
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\xe2\x80\xa8",
+	                 2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 0 );
+
+	/* Test a continuation byte without a lead byte
+	 */
+	sequence_size = libcsplit_utf8_string_get_sequence_size(
+	                 (uint8_t *) "\x80",
+	                 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "sequence_size",
+	 sequence_size,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcsplit_utf8_string_copy_from_code_point function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf8_string_copy_from_code_point(
+     void )
+{
+	uint8_t utf8_sequence[ 4 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t utf8_sequence_length = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x000000a6UL,
+	          utf8_sequence,
+	          4,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_sequence_length",
+	 utf8_sequence_length,
+	 (size_t) 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_sequence,
+	          "\xc2\xa6",
+	          2 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x00002028UL,
+	          utf8_sequence,
+	          4,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_sequence_length",
+	 utf8_sequence_length,
+	 (size_t) 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_sequence,
+	          "\xe2\x80\xa8",
+	          3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x0001f600UL,
+	          utf8_sequence,
+	          4,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_sequence_length",
+	 utf8_sequence_length,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_sequence,
+	          "\xf0\x9f\x98\x80",
+	          4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x0000d800UL,
+	          utf8_sequence,
+	          4,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x00110000UL,
+	          utf8_sequence,
+	          4,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf8_string_copy_from_code_point(
+	          0x00002028UL,
+	          utf8_sequence,
+	          2,
+	          &utf8_sequence_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+/* Tests the libcsplit_utf8_string_split function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_utf8_string_split(
+     void )
+{
+	const char *expected_segments[ 3 ] = { "a", "b", "\xe2\x80\xa8" "c" };
+
+	libcerror_error_t *error                      = NULL;
+	libcsplit_narrow_split_string_t *split_string = NULL;
+	char *string_segment                          = NULL;
+	size_t string_segment_size                    = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+	int segment_index                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "a\xc2\xa6" "b\xc2\xa6\xe2\x80\xa8" "c",
+	          11,
+	          0x000000a6UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcsplit_narrow_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 narrow_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a 3-byte delimiter after a run of ASCII characters that spans the vectorized filter
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xe2\x80\xa8" "end",
+	          69,
+	          0x00002028UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          "end",
+	          4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an ASCII delimiter in a string with multi-byte sequences
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "\xc3\xa9,\xf0\x9f\x98\x80,",
+	          9,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_narrow_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "",
+	          1,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_utf8_string_split(
+	          NULL,
+	          11,
+	          0x000000a6UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "a\xc2\xa6" "b",
+	          5,
+	          0x0000d800UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "a\xc2\xa6" "b",
+	          5,
+	          0x000000a6UL,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an invalid UTF-8 sequence after a run of ASCII characters
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "abcdefghijklmnopqrstuvwxyz0123456789\xc0\xaf",
+	          39,
+	          0x000000a6UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an incomplete UTF-8 sequence at the end of the string
+	 */
+	result = libcsplit_utf8_string_split(
+	          (uint8_t *) "ab\xe2\x80",
+	          5,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf8_string_get_sequence_size",
+	 csplit_test_utf8_string_get_sequence_size );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf8_string_copy_from_code_point",
+	 csplit_test_utf8_string_copy_from_code_point );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_utf8_string_split",
+	 csplit_test_utf8_string_split );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
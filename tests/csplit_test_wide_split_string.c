@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
+#include <wide_string.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "csplit_test_functions.h"
 #include "csplit_test_libcerror.h"
 #include "csplit_test_libcsplit.h"
 #include "csplit_test_macros.h"
@@ -35,6 +38,8 @@
 
 #include "../libcsplit/libcsplit_wide_split_string.h"
 
+#define CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME	"csplit_test_wide_split_string.tmp"
+
 #if defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE )
 
 #if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
@@ -610,6 +615,132 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcsplit_wide_split_string_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_split_string_get_flags(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	uint8_t flags                               = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcsplit_wide_string_split(
+	          L"Test 1 2 3 4 5",
+	          15,
+	          ' ',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_split_string_get_flags(
+	          split_string,
+	          &flags,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_split_string_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_get_flags(
+	          split_string,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libcsplit_wide_split_string_get_segment_by_index function
  * Returns 1 if successful or 0 if not
  */
@@ -1055,48 +1186,736 @@ on_error:
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
 
-#endif /* defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* The main program
+/* Tests the libcsplit_wide_split_string_join function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#endif
+int csplit_test_wide_split_string_join(
+     void )
 {
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+	wchar_t string[ 32 ];
 
-#if defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE )
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	size_t joined_string_size                   = 0;
+	int result                                  = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libcsplit_wide_string_split(
+	          L"Test 1 2 3 4 5",
+	          15,
+	          ' ',
+	          &split_string,
+	          &error );
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_split_string_initialize",
-	 csplit_test_wide_split_string_initialize );
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_split_string_free",
-	 csplit_test_wide_split_string_free );
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_split_string_get_string",
-	 csplit_test_wide_split_string_get_string );
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_split_string_get_joined_string_size(
+	          split_string,
+	          &joined_string_size,
+	          &error );
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_split_string_get_number_of_segments",
-	 csplit_test_wide_split_string_get_number_of_segments );
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_split_string_get_segment_by_index",
-	 csplit_test_wide_split_string_get_segment_by_index );
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "joined_string_size",
+	 joined_string_size,
+	 (size_t) 15 );
+
+	result = libcsplit_wide_split_string_join(
+	          split_string,
+	          ',',
+	          string,
+	          joined_string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          L"Test,1,2,3,4,5",
+	          sizeof( wchar_t ) * 15 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_split_string_get_joined_string_size(
+	          NULL,
+	          &joined_string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_get_joined_string_size(
+	          split_string,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_join(
+	          NULL,
+	          ',',
+	          string,
+	          32,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_join(
+	          split_string,
+	          ',',
+	          NULL,
+	          32,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_join(
+	          split_string,
+	          ',',
+	          string,
+	          joined_string_size - 1,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_split_string_serialize and libcsplit_wide_split_string_deserialize_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_split_string_serialize(
+     void )
+{
+	const wchar_t *expected_segments[ 4 ]                    = { L"ab", L"c", L"", L"def" };
+	libcerror_error_t *error                                 = NULL;
+	libcsplit_wide_split_string_t *deserialized_split_string = NULL;
+	libcsplit_wide_split_string_t *split_string              = NULL;
+	uint8_t *byte_stream                                     = NULL;
+	wchar_t *deserialized_string                             = NULL;
+	wchar_t *string                                          = NULL;
+	wchar_t *string_segment                                  = NULL;
+	size_t deserialized_string_size                          = 0;
+	size_t expected_segment_size                             = 0;
+	size_t serialized_size                                   = 0;
+	size_t string_segment_size                               = 0;
+	size_t string_size                                       = 0;
+	uint8_t flags                                            = 0;
+	int file_created                                         = 0;
+	int number_of_segments                                   = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcsplit_wide_string_split(
+	          L"ab,c,,def",
+	          10,
+	          ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_split_string_get_serialized_size(
+	          split_string,
+	          &serialized_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The header, 4 segment table entries of 2 x 32-bit and 10 characters
+	 */
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) ( 32 + 32 + ( 10 * sizeof( wchar_t ) ) ) );
+
+	byte_stream = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * serialized_size );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	result = libcsplit_wide_split_string_serialize(
+	          split_string,
+	          byte_stream,
+	          serialized_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          byte_stream,
+	          serialized_size );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_created = 1;
+
+	result = libcsplit_wide_split_string_deserialize_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "deserialized_split_string",
+	 deserialized_split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The string and segments are the same as those of the original split string
+	 */
+	result = libcsplit_wide_split_string_get_string(
+	          split_string,
+	          &string,
+	          &string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_wide_split_string_get_string(
+	          deserialized_split_string,
+	          &deserialized_string,
+	          &deserialized_string_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "deserialized_string_size",
+	 deserialized_string_size,
+	 string_size );
+
+	result = memory_compare(
+	          deserialized_string,
+	          string,
+	          sizeof( wchar_t ) * string_size );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_get_flags(
+	          deserialized_split_string,
+	          &flags,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 LIBCSPLIT_SPLIT_STRING_FLAG_READ_ONLY );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          deserialized_split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_wide_split_string_get_segment_by_index(
+		          deserialized_split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The segments are terminated and their sizes include the end-of-string character
+		 */
+		expected_segment_size = wide_string_length(
+		                         expected_segments[ segment_index ] ) + 1;
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 expected_segment_size );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          sizeof( wchar_t ) * expected_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test serializing a deserialized split string
+	 */
+	result = libcsplit_wide_split_string_serialize(
+	          deserialized_split_string,
+	          byte_stream,
+	          serialized_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_free(
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_split_string_get_serialized_size(
+	          NULL,
+	          &serialized_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_serialize(
+	          split_string,
+	          byte_stream,
+	          serialized_size - 1,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_split_string_deserialize_file(
+	          NULL,
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the serialized data is truncated
+	 */
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          byte_stream,
+	          serialized_size - 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_wide_split_string_deserialize_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "deserialized_split_string",
+	 deserialized_split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a segment size is out of bounds
+	 */
+	byte_stream[ 32 + 4 ] = 11;
+
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          byte_stream,
+	          serialized_size );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_wide_split_string_deserialize_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "deserialized_split_string",
+	 deserialized_split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a terminated segment is missing the end-of-string character
+	 */
+	byte_stream[ 32 + 4 ] = 2;
+
+	result = csplit_test_write_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          byte_stream,
+	          serialized_size );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcsplit_wide_split_string_deserialize_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME,
+	          &deserialized_split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "deserialized_split_string",
+	 deserialized_split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	file_created = 0;
+
+	result = csplit_test_remove_file(
+	          CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 byte_stream );
+
+	byte_stream = NULL;
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_created != 0 )
+	{
+		csplit_test_remove_file(
+		 CSPLIT_TEST_WIDE_SPLIT_STRING_FILENAME );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	if( deserialized_split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &deserialized_split_string,
+		 NULL );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_initialize",
+	 csplit_test_wide_split_string_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT ) */
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_free",
+	 csplit_test_wide_split_string_free );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_get_string",
+	 csplit_test_wide_split_string_get_string );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_get_flags",
+	 csplit_test_wide_split_string_get_flags );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_get_number_of_segments",
+	 csplit_test_wide_split_string_get_number_of_segments );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_get_segment_by_index",
+	 csplit_test_wide_split_string_get_segment_by_index );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_join",
+	 csplit_test_wide_split_string_join );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_split_string_serialize",
+	 csplit_test_wide_split_string_serialize );
 
 #if defined( __GNUC__ ) && !defined( LIBCSPLIT_DLL_IMPORT )
 
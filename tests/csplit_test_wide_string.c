@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <wide_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -43,6 +45,9 @@ int csplit_test_wide_string_split(
 {
 	libcerror_error_t *error                    = NULL;
 	libcsplit_wide_split_string_t *split_string = NULL;
+	wchar_t *string_segment                     = NULL;
+	size_t string_segment_size                  = 0;
+	int number_of_segments                      = 0;
 	int result                                  = 0;
 
 	/* Test regular cases
@@ -123,6 +128,92 @@ int csplit_test_wide_string_split(
 	 "error",
 	 error );
 
+	/* Test a string with characters after an end-of-string character
+	 * the last segment runs up to the last character of the string
+	 */
+	result = libcsplit_wide_string_split(
+	          L"a,b\0c",
+	          6,
+	          (wchar_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          L"b\0c",
+	          sizeof( wchar_t ) * 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test empty string
 	 */
 	result = libcsplit_wide_string_split(
@@ -314,28 +405,1845 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE ) */
+/* Tests the libcsplit_wide_string_split_binary function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_string_split_binary(
+     void )
+{
+	size_t expected_segment_offsets[ 4 ] = { 0, 4, 5, 8 };
+	size_t expected_segment_sizes[ 4 ]   = { 3, 0, 2, 0 };
 
-/* The main program
+	libcerror_error_t *error                 = NULL;
+	libcsplit_segment_table_t *segment_table = NULL;
+	size_t segment_offset                    = 0;
+	size_t segment_size                      = 0;
+	int number_of_segments                   = 0;
+	int result                               = 0;
+	int segment_index                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_string_split_binary(
+	          L"a\0b,,c\0,",
+	          8,
+	          (wchar_t) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_segment_table_get_segment_by_index(
+		          segment_table,
+		          segment_index,
+		          &segment_offset,
+		          &segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_offset",
+		 segment_offset,
+		 expected_segment_offsets[ segment_index ] );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_size",
+		 segment_size,
+		 expected_segment_sizes[ segment_index ] );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcsplit_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_wide_string_split_binary(
+	          L"a\0b,,c\0,",
+	          0,
+	          (wchar_t) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_split_binary(
+	          NULL,
+	          8,
+	          (wchar_t) ',',
+	          &segment_table,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_binary(
+	          L"a\0b,,c\0,",
+	          8,
+	          (wchar_t) ',',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libcsplit_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_string_split_from_utf8 function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
-#endif
+int csplit_test_wide_string_split_from_utf8(
+     void )
 {
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
-	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+	const wchar_t *expected_segments[ 3 ] = { L"caf\u00e9", L"\U0001f600x", L"" };
 
-#if defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE )
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	wchar_t *string_segment                     = NULL;
+	size_t string_segment_size                  = 0;
+	int number_of_segments                      = 0;
+	int result                                  = 0;
+	int segment_index                           = 0;
 
-	CSPLIT_TEST_RUN(
-	 "libcsplit_wide_string_split",
-	 csplit_test_wide_string_split );
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "caf\xc3\xa9\xc2\xa6\xf0\x9f\x98\x80x\xc2\xa6",
+	          15,
+	          0x000000a6UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		result = libcsplit_wide_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 wide_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          sizeof( wchar_t ) * string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an ASCII delimiter with multi-byte characters
+	 */
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "\xc3\xa9,\xf0\x9f\x98\x80",
+	          9,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 wide_string_length( L"\U0001f600" ) + 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          L"\U0001f600",
+	          sizeof( wchar_t ) * string_segment_size );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty string
+	 */
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "",
+	          1,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_split_from_utf8(
+	          NULL,
+	          15,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "one,two",
+	          8,
+	          0x0000d800UL,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "one,two",
+	          8,
+	          (uint32_t) ',',
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an invalid UTF-8 sequence
+	 */
+	result = libcsplit_wide_string_split_from_utf8(
+	          (uint8_t *) "one,\xc3(two",
+	          10,
+	          (uint32_t) ',',
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_string_split_multi_string function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_string_split_multi_string(
+     void )
+{
+	const wchar_t *expected_segments[ 2 ] = { L"one", L"two" };
+
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	wchar_t *string_segment                     = NULL;
+	size_t string_segment_size                  = 0;
+	int number_of_segments                      = 0;
+	int result                                  = 0;
+	int segment_index                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_string_split_multi_string(
+	          L"one\0two\0\0ignored",
+	          17,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 2;
+	     segment_index++ )
+	{
+		result = libcsplit_wide_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 wide_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          sizeof( wchar_t ) * string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a multi-string of which the last string is not terminated
+	 */
+	result = libcsplit_wide_string_split_multi_string(
+	          L"one\0two",
+	          8,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          L"two",
+	          sizeof( wchar_t ) * 4 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an empty multi-string
+	 */
+	result = libcsplit_wide_string_split_multi_string(
+	          L"\0",
+	          2,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_split_multi_string(
+	          NULL,
+	          17,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_multi_string(
+	          L"one\0two\0\0ignored",
+	          17,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_string_split_path function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_string_split_path(
+     void )
+{
+	const wchar_t *expected_segments[ 4 ]     = { L"", L"usr", L"local", L"bin" };
+	const wchar_t *expected_unc_segments[ 4 ] = { L"", L"server", L"share", L"x" };
+
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	wchar_t *string_segment                     = NULL;
+	size_t string_segment_size                  = 0;
+	int number_of_segments                      = 0;
+	int result                                  = 0;
+	int segment_index                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_string_split_path(
+	          L"/usr//local/./lib/../bin/",
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_wide_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 wide_string_length( expected_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_segments[ segment_index ],
+		          sizeof( wchar_t ) * string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a path with a drive letter and backslash separators
+	 */
+	result = libcsplit_wide_string_split_path(
+	          L"C:\\Windows\\..\\..\\System32",
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 2 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_segment_size",
+	 string_segment_size,
+	 (size_t) 9 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          L"System32",
+	          sizeof( wchar_t ) * 9 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a relative path with unresolvable parent components
+	 */
+	result = libcsplit_wide_string_split_path(
+	          L"../a/../../b",
+	          13,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_segment_by_index(
+	          split_string,
+	          1,
+	          &string_segment,
+	          &string_segment_size,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string_segment,
+	          L"..",
+	          sizeof( wchar_t ) * 3 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UNC path, ".." does not remove the server and share name
+	 */
+	result = libcsplit_wide_string_split_path(
+	          L"\\\\server\\share\\..\\x",
+	          20,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_split_string_get_number_of_segments(
+	          split_string,
+	          &number_of_segments,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 4 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 4;
+	     segment_index++ )
+	{
+		result = libcsplit_wide_split_string_get_segment_by_index(
+		          split_string,
+		          segment_index,
+		          &string_segment,
+		          &string_segment_size,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+		 "string_segment_size",
+		 string_segment_size,
+		 wide_string_length( expected_unc_segments[ segment_index ] ) + 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          string_segment,
+		          expected_unc_segments[ segment_index ],
+		          sizeof( wchar_t ) * string_segment_size );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libcsplit_wide_split_string_free(
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test paths that normalize to no components, like an empty path these have no segments
+	 */
+	result = libcsplit_wide_string_split_path(
+	          L"./a/..",
+	          7,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcsplit_wide_string_split_path(
+	          L"./.",
+	          4,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_split_path(
+	          NULL,
+	          26,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_path(
+	          L"/usr//local/./lib/../bin/",
+	          26,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_string_split_with_options function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_string_split_with_options(
+     void )
+{
+	const wchar_t *expected_skipped_segments[ 2 ] = { L"a", L"b c" };
+	const wchar_t *expected_trimmed_segments[ 4 ] = { L"a", L"", L"b c", L"" };
+
+	libcerror_error_t *error                    = NULL;
+	libcsplit_wide_split_string_t *split_string = NULL;
+	const wchar_t **expected_segments           = NULL;
+	wchar_t *string_segment                     = NULL;
+	size_t string_segment_size                  = 0;
+	uint8_t flags                               = 0;
+	int expected_number_of_segments             = 0;
+	int number_of_segments                      = 0;
+	int result                                  = 0;
+	int segment_index                           = 0;
+
+	/* Test regular cases
+	 */
+	for( flags = 0;
+	     flags <= LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY;
+	     flags++ )
+	{
+		if( flags == 0 )
+		{
+			expected_segments           = expected_trimmed_segments;
+			expected_number_of_segments = 4;
+		}
+		else
+		{
+			expected_segments           = expected_skipped_segments;
+			expected_number_of_segments = 2;
+		}
+		result = libcsplit_wide_string_split_with_options(
+		          L" a , ,\tb c ,  ",
+		          15,
+		          (wchar_t) ',',
+		          flags,
+		          L" \t",
+		          2,
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+		 "split_string",
+		 split_string );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcsplit_wide_split_string_get_number_of_segments(
+		          split_string,
+		          &number_of_segments,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_segments",
+		 number_of_segments,
+		 expected_number_of_segments );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( segment_index = 0;
+		     segment_index < expected_number_of_segments;
+		     segment_index++ )
+		{
+			result = libcsplit_wide_split_string_get_segment_by_index(
+			          split_string,
+			          segment_index,
+			          &string_segment,
+			          &string_segment_size,
+			          &error );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+			 "string_segment_size",
+			 string_segment_size,
+			 wide_string_length( expected_segments[ segment_index ] ) + 1 );
+
+			CSPLIT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          string_segment,
+			          expected_segments[ segment_index ],
+			          sizeof( wchar_t ) * string_segment_size );
+
+			CSPLIT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libcsplit_wide_split_string_free(
+		          &split_string,
+		          &error );
+
+		CSPLIT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CSPLIT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a string of which all segments are skipped
+	 */
+	result = libcsplit_wide_string_split_with_options(
+	          L",,,",
+	          4,
+	          (wchar_t) ',',
+	          LIBCSPLIT_SPLIT_FLAG_SKIP_EMPTY,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "split_string",
+	 split_string );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_split_with_options(
+	          NULL,
+	          15,
+	          (wchar_t) ',',
+	          0,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_with_options(
+	          L"a,b",
+	          4,
+	          (wchar_t) ',',
+	          0xff,
+	          NULL,
+	          0,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_with_options(
+	          L"a,b",
+	          4,
+	          (wchar_t) ',',
+	          0,
+	          NULL,
+	          1,
+	          &split_string,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_split_with_options(
+	          L"a,b",
+	          4,
+	          (wchar_t) ',',
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( split_string != NULL )
+	{
+		libcsplit_wide_split_string_free(
+		 &split_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcsplit_wide_string_transcode_delimiters function
+ * Returns 1 if successful or 0 if not
+ */
+int csplit_test_wide_string_transcode_delimiters(
+     void )
+{
+	wchar_t string[ 16 ];
+	wchar_t transcoded_string[ 16 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t transcoded_string_length = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 10 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          L"\t\ta\t\tb\tc\t\t",
+	          sizeof( wchar_t ) * 11 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 7 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          L"\ta\tb\tc\t",
+	          sizeof( wchar_t ) * 8 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 6 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          transcoded_string,
+	          L"a\t\tb\tc",
+	          sizeof( wchar_t ) * 7 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test transcoding in place
+	 */
+	memory_copy(
+	 string,
+	 L",,a,;b,c,,",
+	 sizeof( wchar_t ) * 11 );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          string,
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          LIBCSPLIT_TRANSCODE_FLAG_COLLAPSE_RUNS | LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          string,
+	          11,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 5 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          L"a\tb\tc",
+	          sizeof( wchar_t ) * 6 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a string only containing delimiters
+	 */
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,,",
+	          4,
+	          L",",
+	          1,
+	          (wchar_t) ' ',
+	          LIBCSPLIT_TRANSCODE_FLAG_STRIP,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CSPLIT_TEST_ASSERT_EQUAL_SIZE(
+	 "transcoded_string_length",
+	 transcoded_string_length,
+	 (size_t) 0 );
+
+	CSPLIT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcsplit_wide_string_transcode_delimiters(
+	          NULL,
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          NULL,
+	          2,
+	          (wchar_t) '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          0xff,
+	          transcoded_string,
+	          16,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          0,
+	          transcoded_string,
+	          4,
+	          &transcoded_string_length,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcsplit_wide_string_transcode_delimiters(
+	          L",,a,;b,c,,",
+	          11,
+	          L",;",
+	          2,
+	          (wchar_t) '\t',
+	          0,
+	          transcoded_string,
+	          16,
+	          NULL,
+	          &error );
+
+	CSPLIT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CSPLIT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CSPLIT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CSPLIT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argc )
+	CSPLIT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE )
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split",
+	 csplit_test_wide_string_split );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split_binary",
+	 csplit_test_wide_string_split_binary );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split_from_utf8",
+	 csplit_test_wide_string_split_from_utf8 );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split_multi_string",
+	 csplit_test_wide_string_split_multi_string );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split_path",
+	 csplit_test_wide_string_split_path );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_split_with_options",
+	 csplit_test_wide_string_split_with_options );
+
+	CSPLIT_TEST_RUN(
+	 "libcsplit_wide_string_transcode_delimiters",
+	 csplit_test_wide_string_transcode_delimiters );
 
 #endif /* defined( LIBCSPLIT_HAVE_WIDE_CHARACTER_TYPE ) */
 
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "error narrow_split_string narrow_string support wide_split_string wide_string"
+$LibraryTests = "arrow error field_decoder key_value_table narrow_file narrow_record_reader narrow_split_string narrow_stream_splitter narrow_string segment_index simd split_hierarchy support utf16_stream utf16_string utf32_string utf8_string wide_split_string wide_string"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="error narrow_split_string narrow_string support wide_split_string wide_string";
+LIBRARY_TESTS="arrow error field_decoder key_value_table narrow_file narrow_record_reader narrow_split_string narrow_stream_splitter narrow_string segment_index simd split_hierarchy support utf16_stream utf16_string utf32_string utf8_string wide_split_string wide_string";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 